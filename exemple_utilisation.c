@@ -73,7 +73,7 @@ int main(int argc, char* argv[]) {
                 printf("    Vérification T_estUnObjectif: %s\n", 
                        estObjectif ? "OUI" : "NON");
                 
-                free(pCoord);
+                CO_liberer(pCoord);
             } else {
                 printf("  - Élément %u : NULL\n", i);
             }
@@ -0,0 +1,103 @@
+/**
+ * \file FileCirculaire.h
+ * \brief File (FIFO) d'éléments de taille fixe, rangés par valeur dans un tableau circulaire.
+ * \author Nicolas Delestre
+ * \version 1.0
+ * \date 2025
+ *
+ * \section CONCEPTION
+ *  - Les éléments sont copiés octet par octet (tailleElement octets) dans un tableau dont la
+ *    capacité est une puissance de 2 et double quand il est plein : ni copie profonde, ni
+ *    allocation par élément. Le module ne convient donc qu'à des éléments sans pointeur
+ *    vers de la mémoire à libérer (coordonnées, entiers, petites structures).
+ *  - La tête avance circulairement : enfiler et défiler sont en O(1) (amorti pour enfiler).
+ *  - Les erreurs sont signalées dans errno.
+ */
+
+#ifndef __FILECIRCULAIRE_H__
+#define __FILECIRCULAIRE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define FC_CAPACITE_INITIALE 8 /* nombre de cases allouées au premier ajout (toujours une puissance de 2) */
+
+#define FC_FILE_VIDE_ERREUR 1
+#define FC_MEMOIRE_ERREUR   2
+
+/**
+ * \struct FC_FileCirculaire
+ * \brief File circulaire d'éléments de tailleElement octets.
+ */
+typedef struct {
+  unsigned char* elements;      /* tableau de capacite cases de tailleElement octets (NULL tant que rien n'est alloué) */
+  size_t         tailleElement; /* taille d'un élément en octets */
+  unsigned int   capacite;      /* 0 ou une puissance de 2 */
+  unsigned int   tete;          /* case du premier élément */
+  unsigned int   longueur;      /* nombre d'éléments dans la file */
+} FC_FileCirculaire;
+
+/**
+ * \brief Crée une file vide.
+ * \param tailleElement Taille d'un élément en octets (sizeof du type rangé).
+ * \return Une file vide ; aucune mémoire n'est allouée avant le premier ajout.
+ */
+FC_FileCirculaire FC_file(size_t tailleElement);
+
+/**
+ * \brief Vérifie si la file est vide.
+ * \param file La file à vérifier.
+ * \return true si la file est vide, false sinon.
+ */
+bool FC_estVide(FC_FileCirculaire file);
+
+/**
+ * \brief Donne le nombre d'éléments de la file.
+ * \param file La file.
+ * \return Le nombre d'éléments.
+ */
+unsigned int FC_longueur(FC_FileCirculaire file);
+
+/**
+ * \brief Enfile une copie (octet par octet) d'un élément à la fin de la file.
+ * \param pfile Pointeur vers la file.
+ * \param pelement Pointeur vers l'élément à copier.
+ * \post errno=0, ou errno=FC_MEMOIRE_ERREUR si la file ne peut pas grandir, faute de mémoire ou parce que sa
+ *       capacité atteint la plus grande puissance de 2 représentable (elle est alors inchangée).
+ * \complexite O(1) amorti, sans allocation tant que la capacité suffit
+ */
+void FC_enfiler(FC_FileCirculaire* pfile, void* pelement);
+
+/**
+ * \brief Défile l'élément en tête de file.
+ * \param pfile Pointeur vers la file.
+ * \param pelement Pointeur vers la variable qui reçoit l'élément (NULL pour le jeter).
+ * \return true si un élément a été défilé, false si la file est vide (errno=FC_FILE_VIDE_ERREUR).
+ * \complexite O(1), sans allocation
+ */
+bool FC_defiler(FC_FileCirculaire* pfile, void* pelement);
+
+/**
+ * \brief Accède à l'élément en tête de file sans le défiler ni le copier.
+ * \param pfile Pointeur vers la file.
+ * \return L'élément rangé dans la file, ou NULL si la file est vide (errno=FC_FILE_VIDE_ERREUR).
+ * \warning Le pointeur n'est plus valide après une modification de la file.
+ */
+const void* FC_tete(const FC_FileCirculaire* pfile);
+
+/**
+ * \brief Prépare la file à contenir n éléments sans réallocation.
+ * \param pfile Pointeur vers la file.
+ * \param n Nombre d'éléments attendus.
+ * \post La capacité ne diminue jamais ; errno=FC_MEMOIRE_ERREUR en cas de manque de mémoire, ou si n
+ *       dépasse la plus grande capacité possible (la file est alors inchangée).
+ */
+void FC_reserver(FC_FileCirculaire* pfile, unsigned int n);
+
+/**
+ * \brief Vide la file et libère son tableau ; la file reste utilisable.
+ * \param pfile Pointeur vers la file à vider.
+ */
+void FC_vider(FC_FileCirculaire* pfile);
+
+#endif
@@ -49,6 +49,13 @@ bool LCF_estVide(LCF_ListeChaineeFile file);
  */
 void LCF_enfiler(LCF_ListeChaineeFile* pfile, void* element);
 
+/**
+ * \brief Enfile un lment  la fin de la file sans le copier.
+ * \param pfile Pointeur vers la file.
+ * \param element L'lment, allou par l'appelant : il appartient ensuite  la file.
+ */
+void LCF_enfilerPrendre(LCF_ListeChaineeFile* pfile, void* element);
+
 /**
  * \brief Dfile un lment du dbut de la file.
  * \param pfile Pointeur vers la file.
@@ -56,6 +63,14 @@ void LCF_enfiler(LCF_ListeChaineeFile* pfile, void* element);
  */
 void* LCF_defiler(LCF_ListeChaineeFile* pfile);
 
+/**
+ * \brief Dfile l'lment du dbut de la file sans le copier.
+ * \param pfile Pointeur vers la file.
+ * \return L'lment rang dans la file, dont l'appelant devient propritaire ( librer avec
+ *         supprimerElement), ou NULL et ERRNO est mis  FILE_VIDE_ERREUR si la file est vide.
+ */
+void* LCF_defilerPrendre(LCF_ListeChaineeFile* pfile);
+
 /**
  * \brief Accde  l'lment en tte de file sans le dfiler.
  * \param file La file.
@@ -1,15 +1,16 @@
 /**
  * \file ListeChaineeListe.h
- * \brief Interface d'une liste gnrique base sur liste chane,
- *        avec insertion/suppression par position, accs par position,
+ * \brief Interface d'une liste gnrique range dans un tableau contigu,
+ *        avec insertion/suppression par position, accs par position en O(1),
  *        et suivi en O(1) de la longueur.
  * \author Nicolas Delestre et IA gnrative
- * \version 1.0
+ * \version 2.0
  * \date 2025
  *
- * Cette couche "Liste" encapsule la structure de liste chane de bas niveau
- * (voir listeChainee.h) pour offrir des oprations par position (1..n),
- * une gestion de la copie/libration des lments, et le suivi de la longueur.
+ * Cette couche "Liste" range les pointeurs vers les copies des lments dans
+ * un tableau dynamique dont la capacit double quand il est plein : l'ajout
+ * en fin est en O(1) amorti, la lecture d'une position en O(1). L'insertion et
+ * la suppression ailleurs qu'en fin dcalent les lments suivants.
  *
  * Convention d'indexation :
  *   - Les positions sont **0..longueur-1** (0 = tte de liste).
@@ -26,15 +27,20 @@
 #define __LISTECHAINEELISTE_H__
 
 #include <stdbool.h>
-#include "listeChainee.h"
 #include "copieLiberationComparaison.h"
 
+/** \brief Plus assez de mmoire pour agrandir le tableau ou copier l'lment. */
+#define LISTE_MEMOIRE_ERREUR 1
+
 /** \brief La liste est vide (par ex. lecture/suppression impossible). */
 #define LISTE_VIDE_ERREUR 3
 
 /** \brief La position indique n'appartient pas  0..longueur-1. */
 #define POSITION_HORS_BORNES_ERREUR 4
 
+/** \brief Nombre de cases alloues au premier ajout. */
+#define LCL_CAPACITE_INITIALE 4
+
 /*----------------------------------------------------------------------------
  * Types
  *----------------------------------------------------------------------------*/
@@ -47,7 +53,8 @@
  * doit passer par les fonctions de l'API.
  */
 typedef struct {
-  LC_ListeChainee    liste;             /**< Ancre de la liste chane bas niveau. */
+  void**             elements;          /**< Tableau des copies des lments, dans l'ordre (NULL tant que rien n'est allou). */
+  unsigned int       capacite;          /**< Nombre de cases alloues dans elements. */
   CLC_FonctionCopier copierElement;     /**< Copie profonde d'un lment ( l'insertion). */
   CLC_FonctionLiberer supprimerElement; /**< Libration d'un lment ( la suppression/vidage). */
   int                longueur;          /**< Longueur courante (toujours >= 0). */
@@ -103,12 +110,41 @@ int LCL_longueur(LCL_Liste liste);
  *
  * \erreurs
  *   - POSITION_HORS_BORNES_ERREUR si position n'appartient pas [0..longueur]
- *   - autres erreurs possibles selon l'allocateur interne
+ *   - LISTE_MEMOIRE_ERREUR si le tableau ne peut pas grandir ou l'lment tre copi
  *
- * \complexite O(n) (liste chane simple).
+ * \complexite O(1) amorti en fin de liste (position == longueur), O(n - position) sinon.
  */
 void LCL_inserer(LCL_Liste* pliste, void* element, unsigned int position);
 
+/**
+ * \fn LCL_ajouterFin
+ * \brief Ajoute une **copie** de l'lment en fin de liste.
+ *
+ * Equivaut  LCL_inserer(pliste, element, LCL_longueur(*pliste)), sans calcul ni
+ * contrle de position.
+ *
+ * \param pliste    Pointeur sur la liste.
+ * \param element   Pointeur sur l'lment  copier.
+ *
+ * \erreurs LISTE_MEMOIRE_ERREUR si le tableau ne peut pas grandir ou l'lment tre copi
+ * \complexite O(1) amorti, O(1) sans rallocation aprs LCL_reserver.
+ */
+void LCL_ajouterFin(LCL_Liste* pliste, void* element);
+
+/**
+ * \fn LCL_insererPrendre
+ * \brief Insre l'lment lui-mme (sans copie)  la position demande.
+ *
+ * \param pliste    Pointeur sur la liste.
+ * \param element   lment allou par l'appelant, qui appartient ensuite  la liste
+ *                  (libr par supprimerElement).
+ * \param position  Entier 0..longueur.
+ *
+ * \erreurs comme LCL_inserer ; en cas d'erreur l'lment reste  l'appelant.
+ * \complexite comme LCL_inserer, sans allocation pour l'lment.
+ */
+void LCL_insererPrendre(LCL_Liste* pliste, void* element, unsigned int position);
+
 /**
  * \fn LCL_supprimer
  * \brief Supprime l'lment  la position donne (0..longueur-1).
@@ -121,12 +157,25 @@ void LCL_inserer(LCL_Liste* pliste, void* element, unsigned int position);
  *
  * \erreurs
  *   - LISTE_VIDE_ERREUR si la liste est vide
- *   - POSITION_HORS_BORNES_ERREUR si position n'appartient pas [1..longueur]
+ *   - POSITION_HORS_BORNES_ERREUR si position n'appartient pas [0..longueur-1]
  *
- * \complexite O(n)
+ * \complexite O(n - position) : O(1) pour le dernier lment.
  */
 void LCL_supprimer(LCL_Liste* pliste, unsigned int position);
 
+/**
+ * \fn LCL_supprimerPrendre
+ * \brief Retire l'lment de la position donne et le rend, sans copie ni libration.
+ *
+ * \param pliste    Pointeur sur la liste.
+ * \param position  Entier 0..longueur-1.
+ * \return void*    L'lment, dont l'appelant devient propritaire, ou NULL si erreur
+ *                  (mmes codes que LCL_supprimer).
+ *
+ * \complexite comme LCL_supprimer.
+ */
+void* LCL_supprimerPrendre(LCL_Liste* pliste, unsigned int position);
+
 /**
  * \fn LCL_element
  * \brief **Copie** l'lment situ  la position demande et la retourne.
@@ -138,7 +187,7 @@ void LCL_supprimer(LCL_Liste* pliste, unsigned int position);
  *
  * \erreurs (via errno)
  *   - LISTE_VIDE_ERREUR si la liste est vide
- *   - POSITION_HORS_BORNES_ERREUR si position n'appartient pas [1..longueur]
+ *   - POSITION_HORS_BORNES_ERREUR si position n'appartient pas [0..longueur-1]
  *
  * \remarques
  *   - Cette fonction respecte la smantique de copie : l'objet retourn
@@ -146,11 +195,39 @@ void LCL_supprimer(LCL_Liste* pliste, unsigned int position);
  *   - L'appelant devient propritaire du pointeur retourn et doit
  *     le librer avec la fonction adapte (ex: celle symtrique 
  *     `copierElement`).
+ *   - Pour lire sans copie, voir LCL_elementEmprunte.
  *
- * \complexite O(n)
+ * \complexite O(1) plus le cot de la copie.
  */
 void* LCL_element(LCL_Liste liste, unsigned int position);
 
+/**
+ * \fn LCL_elementEmprunte
+ * \brief Donne accs, sans copie,  l'lment situ  la position demande.
+ *
+ * \param pliste    Pointeur sur la liste consulte.
+ * \param position  Entier 0..longueur-1.
+ * \return const void* L'lment rang dans la liste, ou NULL si erreur (mmes
+ *                  codes que LCL_element).
+ *
+ * \warning Le pointeur reste  la liste : il ne doit tre ni modifi ni libr,
+ *          et n'est plus valide aprs LCL_supprimer de cet lment ou LCL_vider.
+ * \complexite O(1), sans allocation
+ */
+const void* LCL_elementEmprunte(const LCL_Liste* pliste, unsigned int position);
+
+/**
+ * \fn LCL_reserver
+ * \brief Agrandit le tableau pour que la liste puisse contenir n lments sans rallocation.
+ *
+ * \param pliste  Pointeur sur la liste.
+ * \param n       Nombre d'lments attendus.
+ *
+ * \post La capacit ne diminue jamais ; errno=LISTE_MEMOIRE_ERREUR et la liste est
+ *       inchange en cas de manque de mmoire.
+ */
+void LCL_reserver(LCL_Liste* pliste, unsigned int n);
+
 /**
  * \fn LCL_copier
  * \brief Copie entire de la liste (lments inclus).
@@ -168,7 +245,7 @@ LCL_Liste LCL_copier(LCL_Liste liste);
  *
  * \param pliste  Pointeur sur la liste.
  *
- * \post LCL_estVide(*pliste) == true, LCL_longueur(*pliste) == 0
+ * \post LCL_estVide(*pliste) == true, LCL_longueur(*pliste) == 0, le tableau est libr.
  * \complexite O(n)
  */
 void LCL_vider(LCL_Liste* pliste);
@@ -0,0 +1,161 @@
+/**
+ * \file TableHachageConcurrente.h
+ * \brief Dictionnaire partageable entre threads, découpé en segments verrouillés indépendamment.
+ * \author Nicolas Delestre
+ * \version 1.0
+ * \date 2025
+ *
+ * \section CONCEPTION
+ *  - Le dictionnaire est formé de nbSegments dictionnaires THD (puissance de 2), chacun
+ *    protégé par son propre verrou lecteurs/rédacteur : une clé appartient toujours au
+ *    segment désigné par son haché.
+ *  - Les lectures (THC_contient, THC_valeur, THC_lire) prennent le verrou en lecture :
+ *    elles ne se bloquent jamais entre elles, et ne sont bloquées que par une écriture
+ *    dans le même segment.
+ *  - Les écritures (THC_inserer, THC_insererSiAbsent, THC_supprimer) ne bloquent que leur
+ *    segment : des threads qui écrivent des clés différentes avancent le plus souvent en parallèle.
+ *  - La sémantique des clés et des valeurs (copies, comparaison, hachage, rangement en ligne)
+ *    est celle du dictionnaire modèle fourni à la création.
+ *  - Aucune fonction ne rend de pointeur vers une valeur rangée : un autre thread pourrait la
+ *    modifier ou la libérer. Les valeurs sont toujours copiées.
+ *
+ * pthread_rwlock_t n'est déclaré qu'avec les interfaces POSIX : en dialecte ISO strict (-std=c11), tout
+ * fichier qui inclut ce module (ou trajet.h) doit définir _POSIX_C_SOURCE (200809L) avant ses #include.
+ */
+
+#ifndef __TABLEHACHAGECONCURRENTE_H__
+#define __TABLEHACHAGECONCURRENTE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "TableHachageDictionnaire.h"
+
+#define THC_NB_SEGMENTS_DEFAUT 16 /* nombre de segments quand 0 est demandé */
+#define THC_TAILLE_LIGNE_CACHE 64 /* chaque segment commence sur sa propre ligne de cache */
+
+#define THC_MEMOIRE_ERREUR     1
+#define THC_CLE_ABSENTE_ERREUR 2
+#define THC_MODE_ERREUR        3
+
+/**
+ * \struct THC_Segment
+ * \brief Un dictionnaire et le verrou qui le protège.
+ */
+typedef struct {
+  _Alignas(THC_TAILLE_LIGNE_CACHE) pthread_rwlock_t verrou;
+  THD_Dictionnaire dico;
+} THC_Segment;
+
+/**
+ * \struct THC_Dictionnaire
+ * \brief Dictionnaire concurrent : tableau de segments indépendants.
+ * \warning la structure elle-même n'est pas protégée : elle doit être créée avant et supprimée après
+ *          les threads qui l'utilisent, et partagée par adresse.
+ */
+typedef struct {
+  THC_Segment* segments;   /* tableau de nbSegments segments (NULL en cas de manque de mémoire) */
+  unsigned int nbSegments; /* puissance de 2 */
+} THC_Dictionnaire;
+
+/**
+ * \brief Crée un dictionnaire concurrent vide.
+ *
+ * \param modele Dictionnaire vide (créé par THD_dictionnaire ou THD_dictionnaireEnLigne) dont
+ *               chaque segment reprend les fonctions et le mode de rangement.
+ * \param nbSegments Nombre de segments, arrondi à la puissance de 2 supérieure (0 pour THC_NB_SEGMENTS_DEFAUT).
+ * \return Le dictionnaire. En cas de manque de mémoire, \c errno=THC_MEMOIRE_ERREUR et il n'a aucun segment.
+ *
+ * \pre \c modele est vide. Les segments partent sans case : s'il a réservé de la place (THD_reserver),
+ *      elle reste au modèle, qui doit alors être vidé par l'appelant ; sinon il n'a pas à être vidé.
+ */
+THC_Dictionnaire THC_dictionnaire(THD_Dictionnaire modele, unsigned int nbSegments);
+
+/**
+ * \brief Renvoie le nombre de paires stockées.
+ *
+ * \param pdico Pointeur vers le dictionnaire consulté.
+ * \return La somme des tailles des segments.
+ * \note Les segments sont comptés l'un après l'autre : pendant des écritures concurrentes,
+ *       le résultat n'est qu'une estimation.
+ */
+unsigned int THC_taille(const THC_Dictionnaire* pdico);
+
+/**
+ * \brief Vérifie si une clé existe dans le dictionnaire.
+ *
+ * \param pdico Pointeur vers le dictionnaire consulté.
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return \c true si la clé est trouvée, \c false sinon.
+ */
+bool THC_contient(const THC_Dictionnaire* pdico, void* pcle);
+
+/**
+ * \brief Retourne une copie de la valeur associée à une clé.
+ *
+ * \param pdico Pointeur vers le dictionnaire consulté.
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return
+ *  - Une copie de la valeur (à libérer avec \c libererValeur) si la clé est présente (\c errno=0).
+ *  - \c NULL si la clé est absente (\c errno=THC_CLE_ABSENTE_ERREUR).
+ */
+void* THC_valeur(const THC_Dictionnaire* pdico, void* pcle);
+
+/**
+ * \brief Copie la valeur associée à une clé dans une variable de l'appelant (dictionnaire en ligne).
+ *
+ * \param pdico Pointeur vers le dictionnaire consulté.
+ * \param pcle Pointeur vers la clé recherchée.
+ * \param pvaleur Pointeur vers la variable qui reçoit les tailleValeur octets de la valeur.
+ * \return \c true si la clé est présente (\c errno=0), \c false sinon (\c errno=THC_CLE_ABSENTE_ERREUR,
+ *         ou \c THC_MODE_ERREUR si le dictionnaire n'est pas en ligne).
+ * \complexite O(1) en moyenne, sans allocation
+ */
+bool THC_lire(const THC_Dictionnaire* pdico, void* pcle, void* pvaleur);
+
+/**
+ * \brief Insère ou met à jour une paire clé/valeur (voir THD_inserer).
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ * \param pcle Pointeur vers la clé à insérer (copiée).
+ * \param pvaleur Pointeur vers la valeur à associer (copiée).
+ */
+void THC_inserer(THC_Dictionnaire* pdico, void* pcle, void* pvaleur);
+
+/**
+ * \brief Insère une paire clé/valeur seulement si la clé est absente, en une seule opération atomique.
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ * \param pcle Pointeur vers la clé à insérer (copiée).
+ * \param pvaleur Pointeur vers la valeur à associer (copiée).
+ * \return \c true si la paire a été insérée, \c false si la clé était déjà présente (sa valeur
+ *         n'est pas modifiée) ou en cas de manque de mémoire (\c errno=THC_MEMOIRE_ERREUR).
+ * \note Quand plusieurs threads calculent la même valeur, seul le premier la range : les autres
+ *       peuvent ensuite relire la valeur gagnante.
+ */
+bool THC_insererSiAbsent(THC_Dictionnaire* pdico, void* pcle, void* pvaleur);
+
+/**
+ * \brief Supprime une paire clé/valeur (voir THD_supprimer).
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ * \param pcle Pointeur vers la clé de la paire à supprimer.
+ */
+void THC_supprimer(THC_Dictionnaire* pdico, void* pcle);
+
+/**
+ * \brief Vide tous les segments ; le dictionnaire reste utilisable.
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ */
+void THC_vider(THC_Dictionnaire* pdico);
+
+/**
+ * \brief Vide le dictionnaire et libère ses segments et leurs verrous.
+ *
+ * \param pdico Pointeur vers le dictionnaire, qui n'a plus aucun segment ensuite.
+ * \pre Plus aucun thread n'utilise le dictionnaire.
+ */
+void THC_supprimerDictionnaire(THC_Dictionnaire* pdico);
+
+#endif
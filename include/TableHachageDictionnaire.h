@@ -1,18 +1,21 @@
 /**
  * \file TableHashDictionnaire.h
- * \brief Dictionnaire gnrique (cl -> valeur) fond sur hachage et listes chanes.
+ * \brief Dictionnaire gnrique (cl -> valeur) fond sur une table de hachage  adressage ouvert.
  * \author Nicolas Delestre et IA gnrative
  * \version 1.0
  * \date 2025
  *
  * \section CONCEPTION
  *  - Dictionnaire associant une cl  une valeur (toutes deux gnriques, manipules en \c void*).
- *  - Les lments sont rpartis dans un tableau de 256 listes chanes.
- *  - La fonction de hachage (interne au .c) calcule un \c unsigned char  partir
- *    de la somme des octets de la cl (\c tailleCle fournie  la cration).
+ *  - Les lments sont rangs dans un tableau contigu de cases (sondage linaire),
+ *    dont la capacit double automatiquement (voir tableHachage.h).
+ *  - La fonction de hachage est fournie  la cration (par dfaut TH_hacherOctets,
+ *    calcule sur les \c tailleCle octets de la cl).
  *  - L'galit des cls est dfinie par \c comparerCle(k1,k2)==0.
  *  - Gestion mmoire via callbacks fournis par l'utilisateur pour copier/librer
  *    les cls et les valeurs.
+ *  - Chaque dictionnaire porte ses propres fonctions (aucun tat global) : lectures
+ *    concurrentes possibles, critures  protger par un verrou (voir tableHachage.h).
  */
 
 #ifndef __TABLEHASHDICTIONNAIRE_H__
@@ -32,6 +35,12 @@
  */
 typedef TH_TableHachage THD_Dictionnaire;
 
+/**
+ * \struct THD_Iterateur
+ * \brief Curseur sur les paires d'un dictionnaire (voir TH_Iterateur).
+ */
+typedef TH_Iterateur THD_Iterateur;
+
 /**
  * \brief Cre un dictionnaire vide.
  *
@@ -41,16 +50,42 @@ typedef TH_TableHachage THD_Dictionnaire;
  * \param tailleCle     Taille en octets des cls (utilise pour le hachage).
  * \param copierValeur  Fonction de copie des valeurs (doit allouer un duplicata).
  * \param libererValeur Fonction de libration des valeurs.
+ * \param hacher        Fonction de hachage des cls, NULL pour le hachage par dfaut (TH_hacherOctets).
  * \return Un dictionnaire initialis et vide.
  *
- * \pre Toutes les fonctions doivent tre non NULL ; \c tailleCle > 0.
+ * \pre Toutes les fonctions, sauf \c hacher, doivent tre non NULL ; \c tailleCle > 0.
  */
 THD_Dictionnaire THD_dictionnaire(CLC_FonctionCopier copierCle,
                                 CLC_FonctionLiberer libererCle,
                                 CLC_FonctionComparer comparerCle,
                                 size_t tailleCle,
                                 CLC_FonctionCopier copierValeur,
-                                CLC_FonctionLiberer libererValeur);
+                                CLC_FonctionLiberer libererValeur,
+                                TH_FonctionHachage hacher);
+
+/**
+ * \brief Cre un dictionnaire vide dont les cls et les valeurs sont ranges par valeur
+ *        (voir TH_tableHachageEnLigne).
+ *
+ * \param copierCle     Fonction de copie des cls, utilise seulement par THD_cles.
+ * \param libererCle    Fonction de libration des cls copies.
+ * \param tailleCle     Taille en octets des cls.
+ * \param copierValeur  Fonction de copie des valeurs, utilise seulement par THD_valeur.
+ * \param libererValeur Fonction de libration des valeurs copies.
+ * \param tailleValeur  Taille en octets des valeurs.
+ * \param hacher        Fonction de hachage des cls, NULL pour le hachage par dfaut (TH_hacherOctets).
+ * \return Un dictionnaire initialis et vide.
+ *
+ * \pre Les cls et les valeurs sont de taille fixe et ne contiennent pas de pointeur vers
+ *      des donnes  copier ; les cls sont compares octet par octet.
+ */
+THD_Dictionnaire THD_dictionnaireEnLigne(CLC_FonctionCopier copierCle,
+                                        CLC_FonctionLiberer libererCle,
+                                        size_t tailleCle,
+                                        CLC_FonctionCopier copierValeur,
+                                        CLC_FonctionLiberer libererValeur,
+                                        size_t tailleValeur,
+                                        TH_FonctionHachage hacher);
 
 /**
  * \brief Indique si le dictionnaire est vide.
@@ -77,6 +112,15 @@ unsigned int THD_taille(THD_Dictionnaire dico);
  */
 bool THD_contient(THD_Dictionnaire dico, void* pcle);
 
+/**
+ * \brief Identique  THD_contient, le dictionnaire tant pass par adresse (aucune copie de la structure).
+ *
+ * \param pdico Pointeur vers le dictionnaire consult (non modifi).
+ * \param pcle Pointeur vers la cl recherche (non modifie).
+ * \return \c true si la cl est trouve, \c false sinon.
+ */
+bool THD_contientRef(const THD_Dictionnaire* pdico, void* pcle);
+
 /**
  * \brief Insre ou met  jour une paire cl/valeur.
  *
@@ -91,6 +135,15 @@ bool THD_contient(THD_Dictionnaire dico, void* pcle);
  */
 void THD_inserer(THD_Dictionnaire* pdico, void* pcle, void* pvaleur);
 
+/**
+ * \brief Insre ou met  jour une paire cl/valeur sans copie (voir TH_insererPrendre).
+ *
+ * \param pdico   Pointeur vers le dictionnaire  modifier.
+ * \param pcle    Cl alloue par l'appelant, qui appartient ensuite au dictionnaire.
+ * \param pvaleur Valeur alloue par l'appelant, qui appartient ensuite au dictionnaire.
+ */
+void THD_insererPrendre(THD_Dictionnaire* pdico, void* pcle, void* pvaleur);
+
 /**
  * \brief Supprime une paire cl/valeur.
  *
@@ -103,6 +156,15 @@ void THD_inserer(THD_Dictionnaire* pdico, void* pcle, void* pvaleur);
  */
 void THD_supprimer(THD_Dictionnaire* pdico, void* pcle);
 
+/**
+ * \brief Supprime une paire et rend sa valeur sans la copier (voir TH_supprimerPrendre).
+ *
+ * \param pdico Pointeur vers le dictionnaire  modifier.
+ * \param pcle  Pointeur vers la cl de la paire  supprimer.
+ * \return La valeur,  librer par l'appelant, ou \c NULL si la cl est absente (\c errno=TH_CLE_ABSENTE_ERREUR).
+ */
+void* THD_supprimerPrendre(THD_Dictionnaire* pdico, void* pcle);
+
 /**
  * \brief Retourne une copie de la valeur associe  une cl.
  *
@@ -117,6 +179,52 @@ void THD_supprimer(THD_Dictionnaire* pdico, void* pcle);
  */
 void* THD_valeur(THD_Dictionnaire dico, void* pcle);
 
+/**
+ * \brief Identique  THD_valeur, le dictionnaire tant pass par adresse (aucune copie de la structure).
+ *
+ * \param pdico Pointeur vers le dictionnaire consult (non modifi).
+ * \param pcle Pointeur vers la cl recherche.
+ * \return Une copie de la valeur, ou \c NULL si la cl est absente (voir THD_valeur).
+ */
+void* THD_valeurRef(const THD_Dictionnaire* pdico, void* pcle);
+
+/**
+ * \brief Retourne la valeur associe  une cl, sans la copier (voir TH_valeurEmpruntee).
+ *
+ * \param dico Le dictionnaire consult.
+ * \param pcle Pointeur vers la cl recherche.
+ * \return
+ *  - Un pointeur vers la valeur range dans le dictionnaire si la cl est prsente (\c errno=0).
+ *  - \c NULL si la cl est absente (\c errno=THD_CLE_ABSENTE_ERREUR).
+ *
+ * \warning La valeur ne doit tre ni modifie ni libre, et le pointeur n'est plus valide
+ *          aprs la prochaine modification du dictionnaire.
+ */
+const void* THD_valeurEmpruntee(THD_Dictionnaire dico, void* pcle);
+
+/**
+ * \brief Identique  THD_valeurEmpruntee, le dictionnaire tant pass par adresse (aucune copie de la structure).
+ *
+ * \param pdico Pointeur vers le dictionnaire consult (non modifi).
+ * \param pcle Pointeur vers la cl recherche.
+ * \return Un pointeur vers la valeur range dans le dictionnaire, ou \c NULL si la cl est absente.
+ */
+const void* THD_valeurEmprunteeRef(const THD_Dictionnaire* pdico, void* pcle);
+
+/**
+ * \brief Retourne la valeur associe  une cl, pour la modifier sur place (voir TH_referenceValeur).
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ * \param pcle Pointeur vers la cl recherche.
+ * \return
+ *  - Un pointeur vers la valeur range dans le dictionnaire si la cl est prsente (\c errno=0).
+ *  - \c NULL si la cl est absente (\c errno=THD_CLE_ABSENTE_ERREUR).
+ *
+ * \warning La valeur ne doit pas tre libre, et le pointeur n'est plus valide aprs la
+ *          prochaine modification du dictionnaire.
+ */
+void* THD_referenceValeur(THD_Dictionnaire* pdico, void* pcle);
+
 /**
  * \brief Retourne une liste contenant toutes les cls du dictionnaire.
  *
@@ -132,6 +240,50 @@ void* THD_valeur(THD_Dictionnaire dico, void* pcle);
  */
 LCL_Liste THD_cles(THD_Dictionnaire dico);
 
+/**
+ * \brief Cre un curseur sur les paires cl/valeur d'un dictionnaire, sans copie.
+ *
+ * \param pdico Pointeur vers le dictionnaire parcouru.
+ * \return Le curseur, positionn avant la premire paire.
+ * \warning Le curseur n'est plus valide ds que le dictionnaire est modifi.
+ */
+THD_Iterateur THD_iterateur(const THD_Dictionnaire* pdico);
+
+/**
+ * \brief Avance le curseur et donne la paire suivante (voir TH_suivant).
+ *
+ * \param pit Pointeur vers le curseur.
+ * \param ppcle Reoit un pointeur vers la cl range dans le dictionnaire (peut tre NULL).
+ * \param ppvaleur Reoit un pointeur vers la valeur range dans le dictionnaire (peut tre NULL).
+ * \return \c true si une paire a t donne, \c false si toutes les paires ont t parcourues.
+ */
+bool THD_suivant(THD_Iterateur* pit, const void** ppcle, const void** ppvaleur);
+
+/**
+ * \brief Mesure le remplissage et la qualit du hachage du dictionnaire (voir TH_statistiques).
+ *
+ * \param pdico Pointeur vers le dictionnaire examin (non modifi).
+ * \return Les statistiques du dictionnaire.
+ */
+TH_Statistiques THD_statistiques(const THD_Dictionnaire* pdico);
+
+/**
+ * \brief Prpare le dictionnaire  recevoir n paires sans redimensionnement (voir TH_reserver).
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ * \param n Nombre de paires attendues.
+ */
+void THD_reserver(THD_Dictionnaire* pdico, unsigned int n);
+
+/**
+ * \brief Supprime toutes les paires en conservant les cases alloues (voir TH_reinitialiser).
+ *
+ * \param pdico Pointeur vers le dictionnaire.
+ *
+ * \post Toutes les paires sont supprimes et libres, \c nbElements=0 ; la capacit est conserve.
+ */
+void THD_reinitialiser(THD_Dictionnaire* pdico);
+
 
 /**
  * \brief Vide compltement le dictionnaire.
@@ -11,8 +11,11 @@
  *  - L’égalité des éléments est définie par `comparerElement(a,b)==0`.
  *  - Les fonctions `copierElement` et `libererElement` gèrent la politique
  *    mémoire (copie profonde / libération).
- *  - La fonction de hachage interne du dictionnaire utilise la taille en
- *    octets fournie à la création pour sommer les octets de la clé (l’élément).
+ *  - La fonction de hachage est fournie à la création (par défaut un mélange
+ *    des octets de l’élément, sur la taille fournie).
+ *  - Comme pour le dictionnaire, les consultations d’un même ensemble peuvent
+ *    être concurrentes, les modifications doivent être protégées par un verrou
+ *    (voir tableHachage.h).
  *
  * \note Les opérations d’ensemble (`DE_union`, `DE_intersection`, `DE_soustraction`)
  *       supposent que les ensembles manipulés sont **compatibles** : même
@@ -34,6 +37,12 @@
  */
 typedef TH_TableHachage THE_Ensemble;
 
+/**
+ * \struct THE_Iterateur
+ * \brief Curseur sur les éléments d’un ensemble (voir TH_Iterateur).
+ */
+typedef TH_Iterateur THE_Iterateur;
+
 /**
  * \brief Crée un ensemble \b vide et prêt à l’emploi.
  *
@@ -41,15 +50,34 @@ typedef TH_TableHachage THE_Ensemble;
  * \param libererElement Fonction de \b libération d’un élément précédemment copié/interné.
  * \param comparerElement Fonction de \b comparaison d’éléments : <0 si a<b, 0 si a==b, >0 sinon.
  * \param tailleElement  Taille \b en octets des éléments (utilisée par le hachage interne).
+ * \param hacher         Fonction de hachage des éléments, NULL pour le hachage par défaut (TH_hacherOctets).
  * \return Un ensemble initialisé et vide.
  *
- * \pre Tous les pointeurs de fonction doivent être non-NULL ; \c tailleElement > 0.
+ * \pre Tous les pointeurs de fonction, sauf \c hacher, doivent être non-NULL ; \c tailleElement > 0.
  * \post L’ensemble est vide (même sémantique que `HD_dictionnaire` pour l’initialisation).
  */
 THE_Ensemble THE_ensemble(CLC_FonctionCopier copierElement,
                         CLC_FonctionLiberer libererElement,
                         CLC_FonctionComparer comparerElement,
-                        size_t tailleElement);
+                        size_t tailleElement,
+                        TH_FonctionHachage hacher);
+
+/**
+ * \brief Crée un ensemble \b vide dont les éléments sont rangés par valeur dans la table
+ *        (voir TH_tableHachageEnLigne) : aucune allocation par élément.
+ *
+ * \param copierElement  Fonction de copie d’un élément, utilisée seulement par THE_elements.
+ * \param libererElement Fonction de libération des éléments copiés.
+ * \param tailleElement  Taille \b en octets des éléments.
+ * \param hacher         Fonction de hachage des éléments, NULL pour le hachage par défaut (TH_hacherOctets).
+ * \return Un ensemble initialisé et vide.
+ *
+ * \pre Les éléments sont de taille fixe, sans pointeur, et comparés octet par octet.
+ */
+THE_Ensemble THE_ensembleEnLigne(CLC_FonctionCopier copierElement,
+                                CLC_FonctionLiberer libererElement,
+                                size_t tailleElement,
+                                TH_FonctionHachage hacher);
 
 /**
  * \brief Indique si l’ensemble est vide.
@@ -79,6 +107,33 @@ unsigned int THE_cardinalite(THE_Ensemble ensemble);
  **/ 
 LCL_Liste THE_elements(THE_Ensemble ensemble);
 
+/**
+ * \brief Crée un curseur sur les éléments d’un ensemble, sans copie.
+ *
+ * \param pensemble Pointeur vers l’ensemble parcouru.
+ * \return Le curseur, positionné avant le premier élément.
+ * \warning Le curseur n’est plus valide dès que l’ensemble est modifié.
+ * \complexite O(1), sans allocation.
+ */
+THE_Iterateur THE_iterateur(const THE_Ensemble* pensemble);
+
+/**
+ * \brief Avance le curseur et donne l’élément suivant.
+ *
+ * \param pit Pointeur vers le curseur.
+ * \param ppelement Reçoit un pointeur vers l’élément rangé dans l’ensemble (ni à modifier, ni à libérer).
+ * \return \c true si un élément a été donné, \c false si tous les éléments ont été parcourus.
+ */
+bool THE_suivant(THE_Iterateur* pit, const void** ppelement);
+
+/**
+ * \brief Mesure le remplissage et la qualité du hachage de l’ensemble (voir TH_statistiques).
+ *
+ * \param pensemble Pointeur vers l’ensemble examiné (non modifié).
+ * \return Les statistiques de l’ensemble.
+ */
+TH_Statistiques THE_statistiques(const THE_Ensemble* pensemble);
+
 /**
  * \brief Ajoute un élément à l’ensemble (s’il n’y est pas déjà).
  *
@@ -89,7 +144,7 @@ LCL_Liste THE_elements(THE_Ensemble ensemble);
  *  - Si l’élément n’était pas présent : insertion, la taille augmente, \c errno=0.
  *  - S’il était déjà présent : l’ensemble est inchangé (remplacement équivalent),
  *    \c errno peut être positionné à \c HD_CLE_DEJA_PRESENTE_INFO par le dictionnaire.
- * \complexite Amortie O(1), O(n) au pire sur la liste chaînée correspondante.
+ * \complexite Amortie O(1), O(n) au pire (groupe de cases contiguës).
  */
 void THE_ajouter(THE_Ensemble* pensemble, void* pelement);
 
@@ -102,7 +157,7 @@ void THE_ajouter(THE_Ensemble* pensemble, void* pelement);
  * \post
  *  - Si l’élément existait : suppression, la taille diminue, \c errno=0.
  *  - Sinon : ensemble inchangé, \c errno=HD_CLE_ABSENTE_ERREUR (renvoyé par le dictionnaire).
- * \complexite Amortie O(1), O(n) au pire sur la liste chaînée correspondante.
+ * \complexite Amortie O(1), O(n) au pire (groupe de cases contiguës).
  */
 void THE_supprimer(THE_Ensemble* pensemble, void* pelement);
 
@@ -113,10 +168,20 @@ void THE_supprimer(THE_Ensemble* pensemble, void* pelement);
  * \param pelement Pointeur vers l’élément à rechercher (jamais modifié).
  * \return \c true si l’élément appartient à l’ensemble, \c false sinon.
  * \note Ne modifie ni l’ensemble ni \c errno.
- * \complexite Amortie O(1), O(n) au pire sur la liste chaînée correspondante.
+ * \complexite Amortie O(1), O(n) au pire (groupe de cases contiguës).
  */
 bool THE_estPresent(THE_Ensemble ensemble, void* pelement);
 
+/**
+ * \brief Identique à THE_estPresent, l’ensemble étant passé par adresse (aucune copie de la structure).
+ *
+ * \param pensemble Pointeur vers l’ensemble consulté (non modifié).
+ * \param pelement Pointeur vers l’élément à rechercher (jamais modifié).
+ * \return \c true si l’élément appartient à l’ensemble, \c false sinon.
+ * \complexite Amortie O(1), O(n) au pire (groupe de cases contiguës).
+ */
+bool THE_estPresentRef(const THE_Ensemble* pensemble, void* pelement);
+
 /**
  * \brief Renvoie l’\b union de deux ensembles (nouvel ensemble).
  *
@@ -166,6 +231,24 @@ THE_Ensemble THE_soustraction(THE_Ensemble a, THE_Ensemble b);
  */
 void THE_vider(THE_Ensemble* pensemble);
 
+/**
+ * \brief Prépare l’ensemble à recevoir n éléments sans redimensionnement (voir \c TH_reserver).
+ *
+ * \param pensemble Pointeur vers l’ensemble.
+ * \param n Nombre d’éléments attendus.
+ * \post La capacité ne diminue jamais ; \c errno=TH_MEMOIRE_ERREUR en cas de manque de mémoire.
+ */
+void THE_reserver(THE_Ensemble* pensemble, unsigned int n);
+
+/**
+ * \brief Supprime tous les éléments en conservant les cases allouées (voir \c TH_reinitialiser).
+ *
+ * \param pensemble Pointeur vers l’ensemble.
+ * \post Tous les éléments sont supprimés, la taille devient 0, la capacité est conservée, \c errno=0.
+ * \complexite O(capacité), sans allocation.
+ */
+void THE_reinitialiser(THE_Ensemble* pensemble);
+
 
 
 #endif /* __DICTIONNAIREENSEMBLE_H__ */
@@ -0,0 +1,59 @@
+/**
+ * \file allocateurBlocs.h
+ * \brief Allocateur de petits blocs par classes de taille, avec listes libres propres à chaque thread.
+ * \author Nicolas Delestre
+ * \version 1.0
+ * \date 2025
+ *
+ * \section CONCEPTION
+ *  - Les demandes de 1 à AB_TAILLE_MAX octets sont arrondies à une classe (8, 16, 32 ou 64 octets).
+ *    Chaque classe découpe des plaques de AB_TAILLE_PLAQUE octets : une allocation est le retrait
+ *    de la tête de la liste libre, ou à défaut l'avancée d'un pointeur dans la plaque courante.
+ *  - Listes libres et plaques courantes sont propres à chaque thread (_Thread_local) : ni
+ *    verrou ni opération atomique sur le chemin courant. Seule l'obtention d'une nouvelle plaque
+ *    prend un verrou global.
+ *  - Un bloc peut être libéré par un autre thread que celui qui l'a alloué : il rejoint alors la
+ *    liste libre du thread qui le libère.
+ *  - Un dépôt global, protégé par le même verrou, fait circuler les blocs entre threads : un thread
+ *    dont une liste libre dépasse 2*AB_TAILLE_LOT blocs y verse un lot, et à la fin d'un thread ses
+ *    listes libres et le reste de ses plaques courantes y sont versés. Un thread à court de blocs
+ *    reprend un lot du dépôt avant de demander une nouvelle plaque.
+ *  - Les plaques ne sont jamais rendues au système : la mémoire d'une classe reste disponible
+ *    pour les allocations suivantes de cette classe, dans tous les threads.
+ *  - Au-delà de AB_TAILLE_MAX octets, les demandes sont transmises à malloc/free.
+ *
+ * Un bloc doit être libéré par AB_liberer avec la taille demandée à l'allocation, jamais par free.
+ *
+ * Compilé avec -DAB_DESACTIVER, le module se contente d'appeler malloc et free, pour que les
+ * outils de vérification mémoire (valgrind, -fsanitize=address) suivent chaque bloc.
+ */
+
+#ifndef __ALLOCATEURBLOCS_H__
+#define __ALLOCATEURBLOCS_H__
+
+#include <stddef.h>
+
+#define AB_TAILLE_MAX    64    /* plus grande taille servie par les classes */
+#define AB_NB_CLASSES    4     /* classes de 8, 16, 32 et 64 octets */
+#define AB_TAILLE_PLAQUE 65536 /* taille des plaques découpées en blocs */
+#define AB_TAILLE_LOT    256   /* nombre de blocs échangés d'un coup avec le dépôt global */
+
+/**
+ * \brief Alloue un bloc d'au moins taille octets.
+ *
+ * \param taille Nombre d'octets voulus.
+ * \return Un bloc aligné sur 8 octets (16 à partir de 16 octets), ou NULL en cas de manque de mémoire.
+ * \complexite O(1)
+ */
+void* AB_allouer(size_t taille);
+
+/**
+ * \brief Rend un bloc obtenu par AB_allouer.
+ *
+ * \param p Le bloc (NULL est accepté et ignoré).
+ * \param taille La taille demandée lors de l'allocation du bloc.
+ * \complexite O(1)
+ */
+void AB_liberer(void* p, size_t taille);
+
+#endif
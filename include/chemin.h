@@ -9,7 +9,7 @@
 #ifndef __CHEMIN__
 #define __CHEMIN__
 
-#include "ListeChaineeFile.h"
+#include "FileCirculaire.h"
 #include "coordonnee.h"   
 
 /* -------------------------------------------------------------------------- */
@@ -21,8 +21,7 @@
  * \brief Chemin représentant des cases à parcourir
  */
 typedef struct {
-    LCF_ListeChaineeFile etapes;   /**< File de coordonnées (FIFO)*/
-    unsigned int longueur;
+    FC_FileCirculaire etapes;   /**< File de coordonnées (FIFO), rangées par valeur */
 } CH_Chemin;
 
 /* -------------------------------------------------------------------------- */
@@ -59,6 +58,7 @@ unsigned int CH_longueurChemin(CH_Chemin ch);
 /**
  * \brief Suppression d'un chemin.
  * \param ch chemin à supprimer
+ * \note À appeler même après avoir défilé toutes les étapes : le tableau des étapes n'est libéré qu'ici.
  */
 void CH_supprimerChemin(CH_Chemin* ch);
 
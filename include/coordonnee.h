@@ -10,6 +10,7 @@
 #define __COORDONNEES__
 
 #include <stdbool.h>
+#include <stddef.h>
 #include "direction.h"
 
 /* -------------------------------------------------------------------------- */
@@ -87,7 +88,8 @@ unsigned int CO_CoordonneeVersNumeroCase(CO_Coordonnee c, unsigned int largeur);
 /**
  * \brief Copie un pointeur vers une coordonnée.
  * \param pcoord Le pointeur à copier.
- * \return La copie de pcoord
+ * \return La copie de pcoord (petit bloc, voir allocateurBlocs.h), NULL en cas de manque de mémoire
+ * \warning La copie se libère avec CO_liberer, jamais avec free.
  */
 void* CO_copier(void* pcoord);
 
@@ -103,4 +105,14 @@ void CO_liberer(void* pcoord);
  */
 int CO_comparer(void* pcoord1,void* pcoord );
 
+/**
+ * \brief Hache un pointeur vers une coordonnée (fonction de hachage des tables).
+ * Les deux composantes sont mélangées ensemble : des coordonnées de même x+y ne se
+ * retrouvent pas dans les mêmes cases.
+ * \param pcoord Le pointeur vers la coordonnée.
+ * \param taille Ignorée (sizeof(CO_Coordonnee)).
+ * \return Le haché de la coordonnée
+ */
+size_t CO_hacher(void* pcoord, size_t taille);
+
 #endif
\ No newline at end of file
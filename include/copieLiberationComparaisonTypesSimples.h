@@ -4,6 +4,9 @@
  * \author Nicolas Delestre
  * \version 0.1
  * \date 2025
+ *
+ * Les copies des types simples sont de petits blocs (voir allocateurBlocs.h) : elles se libèrent
+ * avec la fonction de libération du même type, jamais avec free.
  **/
 #ifndef __COPIELIBERATIONCOMPARAISONTYPESIMPLE_H__
 #define __COPIELIBERATIONCOMPARAISONTYPESIMPLE_H__
@@ -9,21 +9,46 @@
 #ifndef __GRAPHE__
 #define __GRAPHE__
 #include <stdlib.h>
+#include <stdio.h>
 #include <stdbool.h>
 #include <errno.h>
 #include "copieLiberationComparaison.h"
 #include "ListeChaineeListe.h"
 #include "TableHachageDictionnaire.h"
+#include "TableHachageEnsemble.h"
 
 typedef struct {
   unsigned int src; // id du sommet source
   unsigned int dest; // id du sommet destination
 } G_Arc;
 
+typedef struct {
+  unsigned int* ids; // tableau dynamique d'ids de sommets
+  unsigned int nb; // nombre d'ids stockés
+  unsigned int capacite; // nombre de cases allouées
+  float* poids; // poids des arcs, parallèle à ids (NULL si le graphe n'est pas pondéré, et toujours pour les entrants)
+} G_TableauIds;
+
+typedef struct {
+  G_TableauIds sortants; // voisins du sommet (successeurs si le graphe est orienté), un par arc
+  G_TableauIds entrants; // prédécesseurs du sommet. Toujours vide si le graphe n'est pas orienté
+} G_Adjacence;
+
 typedef struct {
   bool oriente; // true si le graphe est orienté, false sinon
+  bool pondere; // true si chaque arc porte un poids numérique, stocké avec son entrée d'adjacence (voir G_activerPoids)
   LCL_Liste sommets; // liste des ids des sommets présents dans le graphe
-  LCL_Liste arcs; // liste des arcs présents dans le graphe (type G_Arc)
+  LCL_Liste arcs; // liste des arcs présents dans le graphe (type G_Arc), dans un ordre quelconque : une suppression y déplace le dernier arc
+  THD_Dictionnaire indexArcs; // arc présent (type G_Arc, sous forme canonique (min,max) si le graphe n'est pas orienté) -> sa position dans arcs : test d'appartenance et suppression sans parcours
+  unsigned int nbArcsEnDouble; // nombre d'ajouts d'arcs refusés parce que l'arc était déjà présent
+  unsigned int nbArcsRejetes; // nombre d'arcs refusés parce qu'un de leurs ids sort de la plage d'un graphe dense
+  G_Adjacence* adjacences; // adjacences des sommets indexées par id, tenues à jour par G_ajouterArc, G_supprimerArc et G_supprimerSommet
+  unsigned int nbAdjacences; // nombre de cases du tableau adjacences (ids 0..nbAdjacences-1)
+  bool dense; // true si le graphe a été créé par G_grapheDense : les ids sont 0..nbIdsDense-1 et la liste sommets n'est pas utilisée
+  unsigned int nbIdsDense; // nombre d'ids admis en mode dense
+  unsigned char* presence; // bitmap de présence des sommets (mode dense)
+  unsigned int nbSommets; // nombre de sommets présents (mode dense)
+  void** etiquettesDenses; // étiquettes indexées par id (mode dense, NULL si le graphe n'est pas étiqueté)
   THD_Dictionnaire etiquettes; // table de hachage des étiquettes des sommets (clé : id du sommet, valeur : étiquette). Vide si le graphe n'est pas étiqueté
   void* (*copierEtiquette) (void*); // fonction de copie d'étiquette. Null si le graphe n'est pas étiqueté
   void (*libererEtiquette) (void*); // fonction de libération d'étiquette. Null si le graphe n'est pas étiqueté
@@ -34,6 +59,37 @@ typedef struct {
   int (*comparerValeurs) (void*, void*); // fonction de comparaison de valeurs. Null si le graphe n'est pas valué
 } G_Graphe;
 
+/**
+ * \struct G_GrapheFige
+ * \brief Instantané non modifiable d'un graphe au format CSR (compressed sparse row).
+ * Les voisins du sommet id sont voisins[debuts[id]] .. voisins[debuts[id+1]-1], triés par id croissant et sans doublon.
+ * Pour un graphe pondéré, poids[i] est le poids de l'arc vers voisins[i].
+ * Format binaire (voir G_ecrireFige) : en-tête de 6 entiers de 32 bits (signature "GFIG", version, marqueur d'ordre des octets,
+ * options (bit 0 : orienté, bit 1 : pondéré), nbIds, nbEntrees), puis debuts (nbIds+1 entiers, aucun si nbIds vaut 0), voisins et,
+ * si le graphe est pondéré, poids. Tout est dans l'ordre des octets de la machine et aligné sur 4 octets.
+ */
+typedef struct {
+  bool oriente; // true si le graphe d'origine est orienté
+  unsigned int nbIds; // les ids indexables vont de 0 à nbIds-1
+  unsigned int nbEntrees; // nombre de cases du tableau voisins
+  unsigned int* debuts; // tableau de nbIds+1 positions dans voisins
+  unsigned int* voisins; // ids des voisins, rangés sommet par sommet
+  float* poids; // poids des arcs, parallèle à voisins (NULL si le graphe d'origine n'est pas pondéré)
+  void* zone; // projection en mémoire du fichier chargé par G_charger, qui contient les tableaux (NULL s'ils ont été alloués)
+  size_t tailleZone; // taille de la projection
+} G_GrapheFige;
+
+/**
+ * \struct G_IterateurVoisins
+ * \brief Curseur sur les voisins d'un sommet, qui lit directement le stockage interne du graphe (ni allocation, ni copie).
+ * \warning Le curseur n'est plus valide dès que le graphe est modifié.
+ */
+typedef struct {
+  const unsigned int* courant; // prochain voisin à retourner
+  const unsigned int* fin; // fin de la plage des voisins
+  const float* poids; // poids de l'arc vers le prochain voisin (NULL si le graphe n'est pas pondéré)
+} G_IterateurVoisins;
+
 #define G_GRAPHE_NON_ETIQUETE_ERREUR 1
 #define G_GRAPHE_ETIQUETE_ERREUR 2
 #define G_GRAPHE_NON_VALUE_ERREUR 3
@@ -42,6 +98,9 @@ typedef struct {
 #define G_ARC_ERREUR 6
 #define G_GRAPHE_INCOHERENT_ERREUR 7
 #define G_MEMOIRE_ERREUR 8
+#define G_GRAPHE_NON_PONDERE_ERREUR 9
+#define G_ARC_DEJA_PRESENT_ERREUR 10
+#define G_FICHIER_ERREUR 11
 
 /**
  * \brief Crée un graphe
@@ -64,12 +123,31 @@ G_Graphe G_graphe(bool oriente,
 		  void (*libererValeur) (void*),
 		  int (*comparerValeurs) (void*, void*));
 
+/**
+ * \brief Crée un graphe dont les ids de sommets sont les entiers contigus 0..nbIds-1
+ * \param oriente Booléen indiquant si le graphe est orienté (true) ou non (false)
+ * \param nbIds Nombre d'ids admis
+ * \brief Les autres paramètres ont le même rôle que pour G_graphe.
+ * La présence des sommets est stockée dans un bitmap et les données des sommets dans des tableaux indexés par id :
+ * G_ajouterSommet et G_sommetPresent sont en O(1), G_sommets en O(nbIds).
+ * \return Le graphe créé, sans sommet. En cas de manque de mémoire, errno contient le code d'erreur : G_MEMOIRE_ERREUR (et le graphe n'admet aucun id).
+ * Si les fonctions de gestion des étiquettes et des valeurs ne sont pas bien renseignées ensemble, errno contient le code d'erreur : G_GRAPHE_INCOHERENT_ERREUR
+ */
+G_Graphe G_grapheDense(bool oriente,
+		       unsigned int nbIds,
+		       void* (*copierEtiquette) (void*),
+		       void (*libererEtiquette) (void*),
+		       int (*comparerEtiquettes) (void*, void*),
+		       void* (*copierValeur) (void*),
+		       void (*libererValeur) (void*),
+		       int (*comparerValeurs) (void*, void*));
+
 /**
  * \brief Ajoute un sommet au graphe
  * \param pg Pointeur vers le graphe
  * \param id Identifiant du sommet à ajouter, il ne doit pas être déjà présent dans le graphe
  * \param petiquette  Pointeur vers l'étiquette du sommet à ajouter (NULL si le graphe n'est pas étiqueté)
- * \return L'id du sommet ajouté, ou -1 en cas d'erreur et errno contient le code d'erreur : G_SOMMET_ERREUR
+ * \return L'id du sommet ajouté, ou -1 en cas d'erreur et errno contient le code d'erreur : G_SOMMET_ERREUR (pour un graphe dense, aussi si id n'est pas admis)
  */
 int G_ajouterSommet(G_Graphe *pg, unsigned int id, void *petiquette);
 
@@ -79,15 +157,72 @@ int G_ajouterSommet(G_Graphe *pg, unsigned int id, void *petiquette);
  * \param idSrc Indice du sommet source
  * \param idDest Indice du sommet destination
  * \param pvaleur Pointeur vers la valeur de l'arc à ajouter (NULL si le graphe n'est pas valué)
- * \return 0 si l'arc a été ajouté avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_SOMMET_ERREUR ou G_GRAPHE_NON_VALUE_ERREUR
+ * \return 0 si l'arc a été ajouté avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_SOMMET_ERREUR (id non admis par un graphe dense, nbArcsRejetes est incrémenté), G_GRAPHE_NON_VALUE_ERREUR, G_MEMOIRE_ERREUR
+ * ou G_ARC_DEJA_PRESENT_ERREUR (l'arc, ou pour un graphe non orienté l'arc inverse, est déjà présent : il n'est pas ajouté une seconde fois et nbArcsEnDouble est incrémenté)
  */
 int G_ajouterArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *pvaleur);
 
+/**
+ * \brief Rend le graphe pondéré : chaque arc porte un poids (float) stocké à côté de son entrée d'adjacence,
+ * sans passer par la table des valeurs. Les arcs déjà présents, et ceux ajoutés ensuite par G_ajouterArc ou G_ajouterArcs, ont le poids 1
+ * \param pg Pointeur vers le graphe
+ * \return 0 en cas de succès (aussi si le graphe est déjà pondéré), -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_MEMOIRE_ERREUR
+ * \complexite O(V+E)
+ */
+int G_activerPoids(G_Graphe *pg);
+
+/**
+ * \brief Ajoute un arc pondéré entre deux sommets du graphe
+ * \param pg Pointeur vers le graphe (pondéré)
+ * \param idSrc Indice du sommet source
+ * \param idDest Indice du sommet destination
+ * \param poids Poids de l'arc (pour un graphe non orienté, il vaut dans les deux sens)
+ * \return 0 si l'arc a été ajouté avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_GRAPHE_NON_PONDERE_ERREUR, G_SOMMET_ERREUR, G_MEMOIRE_ERREUR ou G_ARC_DEJA_PRESENT_ERREUR (voir G_ajouterArc)
+ */
+int G_ajouterArcPondere(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, float poids);
+
+/**
+ * \brief Retourne le poids d'un arc
+ * \param pg Pointeur vers le graphe
+ * \param idSrc Indice du sommet source
+ * \param idDest Indice du sommet destination
+ * \return Le poids de l'arc de idSrc vers idDest (1 si le graphe n'est pas pondéré). Si l'arc n'existe pas, la fonction retourne 0 et la variable errno contient le code d'erreur : G_ARC_ERREUR
+ * \complexite O(d) où d est le degré de idSrc
+ */
+float G_obtenirPoids(const G_Graphe *pg, unsigned int idSrc, unsigned int idDest);
+
+/**
+ * \brief Modifie le poids de l'arc de idSrc vers idDest (et de l'arc inverse pour un graphe non orienté)
+ * \param pg Pointeur vers le graphe (pondéré)
+ * \param idSrc Indice du sommet source
+ * \param idDest Indice du sommet destination
+ * \param poids Nouveau poids
+ * \return 0 si le poids a été modifié avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_GRAPHE_NON_PONDERE_ERREUR ou G_ARC_ERREUR
+ * \complexite O(d) où d est le plus grand des degrés de idSrc et idDest
+ */
+int G_fixerPoids(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, float poids);
+
+/**
+ * \brief Ajoute d'un coup un lot d'arcs (non valués) au graphe
+ * \param pg Pointeur vers le graphe
+ * \param arcs Tableau des arcs à ajouter
+ * \param nbArcs Nombre d'arcs du tableau
+ * \return Le nombre d'arcs réellement ajoutés (de poids 1 si le graphe est pondéré), ou -1 en cas de manque de mémoire (aucun arc n'est alors ajouté,
+ * errno=G_MEMOIRE_ERREUR). Si des arcs ont été refusés parce qu'un de leurs ids n'est pas admis par un graphe dense, les autres sont ajoutés,
+ * errno=G_SOMMET_ERREUR et nbArcsRejetes est augmenté du nombre d'arcs refusés ; sinon errno=0
+ * \note Le lot est trié (tri par base), les doublons sont éliminés, ainsi que les arcs inverses pour un graphe non orienté
+ * et les arcs déjà présents dans le graphe (sans compter dans nbArcsEnDouble). Les adjacences sont construites en une passe, avec une seule réservation par sommet.
+ * Les arcs ajoutés sont placés en fin de la liste des arcs, triés par (src,dest) (par (min,max) pour un graphe non orienté)
+ * \complexite O(n + d + E) où n est la taille du lot, d le plus grand id rencontré et E le nombre d'arcs déjà présents (raccordement en fin de liste)
+ */
+int G_ajouterArcs(G_Graphe *pg, const G_Arc *arcs, unsigned int nbArcs);
+
 /**
  * \brief Vérifie si un sommet est présent dans le graphe
  * \param g Le graphe
  * \param id L'id du sommet à vérifier
  * \return true si le sommet est présent, false sinon
+ * \complexite O(1) pour un graphe dense, O(V) sinon
  */
 bool G_sommetPresent(G_Graphe g, unsigned int id);
 
@@ -97,15 +232,28 @@ bool G_sommetPresent(G_Graphe g, unsigned int id);
  * \param idSrc L'id du sommet source
  * \param idDest L'id du sommet destination
  * \return true si l'arc est présent, false sinon
+ * \complexite une recherche dans l'index des arcs
  */
 bool G_arcPresent(G_Graphe g, unsigned int idSrc, unsigned int idDest);
 
+/**
+ * \brief Identique à G_arcPresent, le graphe étant passé par adresse (aucune copie de la structure)
+ * \param pg Pointeur vers le graphe (non modifié)
+ * \param idSrc L'id du sommet source
+ * \param idDest L'id du sommet destination
+ * \return true si l'arc est présent, false sinon
+ * \complexite une recherche dans l'index des arcs
+ */
+bool G_arcPresentRef(const G_Graphe *pg, unsigned int idSrc, unsigned int idDest);
+
 /**
  * \brief Supprime un sommet du graphe
  * \param pg Pointeur vers le graphe
  * \param id Indice du sommet à supprimer
  * \return 0 si le sommet a été supprimé avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_SOMMET_ERREUR
- * \note La suppression d'un sommet entraîne la suppression de tous les arcs associés à ce sommet
+ * \note La suppression d'un sommet entraîne la suppression de tous les arcs associés à ce sommet (et de leurs valeurs)
+ * \complexite O(V) pour retrouver le sommet (O(1) pour un graphe dense), plus O(degré) par voisin pour mettre à jour les adjacences ;
+ * chaque arc est retiré de la liste des arcs en O(1)
  */
 int G_supprimerSommet(G_Graphe *pg, unsigned int id);
 
@@ -114,7 +262,8 @@ int G_supprimerSommet(G_Graphe *pg, unsigned int id);
  * \param pg Pointeur vers le graphe
  * \param idSrc Indice du sommet source
  * \param idDest Indice du sommet destination
- * \return 0 si l'arc a été supprimé avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_SOMMET_ERREUR
+ * \return 0 si l'arc a été supprimé avec succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_ARC_ERREUR (arc absent)
+ * \complexite O(degré) des deux extrémités
  */
 int G_supprimerArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest);
 
@@ -122,6 +271,7 @@ int G_supprimerArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest);
  * \brief Retourne un tableau des ids des sommets présents dans le graphe
  * \param g Le graphe
  * \return Une liste chaînée contenant les ids des sommets présents dans le graphe 
+ * \complexite O(V), O(nbIds) pour un graphe dense
  */
 LCL_Liste G_sommets(G_Graphe g);
 
@@ -130,9 +280,47 @@ LCL_Liste G_sommets(G_Graphe g);
  * \param g Le graphe
  * \param idSrc Indice du sommet dont on veut connaître les sommets adjacents
  * \return Une liste chaînée contenant les ids des sommets adjacents au sommet donné. En cas d'erreur (sommet inexistant), la fonction retourne une liste vide et la variable errno contient le code d'erreur : G_SOMMET_ERREUR
+ * \complexite O(d) où d est le degré de idSrc
  */
 LCL_Liste G_obtenirSommetsAdjacents(G_Graphe g, unsigned int idSrc);
 
+/**
+ * \brief Crée un curseur sur les voisins d'un sommet (mêmes voisins, dans le même ordre, que G_obtenirSommetsAdjacents)
+ * \param pg Pointeur vers le graphe
+ * \param id L'id du sommet
+ * \return Le curseur, positionné avant le premier voisin (vide si le sommet n'a pas de voisin)
+ * \complexite O(1), sans allocation
+ */
+G_IterateurVoisins G_iterateurVoisins(const G_Graphe *pg, unsigned int id);
+
+/**
+ * \brief Crée un curseur sur les voisins d'un sommet d'un graphe figé
+ * \param pgf Pointeur vers le graphe figé
+ * \param id L'id du sommet
+ * \return Le curseur, positionné avant le premier voisin (vide si le sommet n'a pas de voisin)
+ * \complexite O(1), sans allocation
+ */
+G_IterateurVoisins G_iterateurVoisinsFige(const G_GrapheFige *pgf, unsigned int id);
+
+/**
+ * \brief Avance le curseur et donne le voisin suivant
+ * \param pit Pointeur vers le curseur
+ * \param pid Pointeur vers l'entier qui reçoit l'id du voisin
+ * \return true si un voisin a été donné, false si tous les voisins ont été parcourus
+ * \complexite O(1)
+ */
+bool G_voisinSuivant(G_IterateurVoisins *pit, unsigned int *pid);
+
+/**
+ * \brief Avance le curseur et donne le voisin suivant avec le poids de l'arc qui y mène
+ * \param pit Pointeur vers le curseur
+ * \param pid Pointeur vers l'entier qui reçoit l'id du voisin
+ * \param ppoids Pointeur vers le réel qui reçoit le poids de l'arc (1 si le graphe n'est pas pondéré)
+ * \return true si un voisin a été donné, false si tous les voisins ont été parcourus
+ * \complexite O(1)
+ */
+bool G_voisinSuivantPondere(G_IterateurVoisins *pit, unsigned int *pid, float *ppoids);
+
 /**
  * \brief Retourne l'étiquette d'un sommet
  * \param g Le graphe
@@ -176,4 +364,86 @@ int G_fixerValeur(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *p
  */
 void G_vider(G_Graphe *pg);
 
-#endif 
+/**
+ * \brief Construit un instantané CSR non modifiable du graphe (les poids sont repris, les étiquettes et les valeurs ne le sont pas)
+ * \param g Le graphe à figer
+ * \return Le graphe figé. En cas de manque de mémoire, le graphe figé retourné est vide et la variable errno contient le code d'erreur : G_MEMOIRE_ERREUR
+ * \note Les arcs en double sont fusionnés (en gardant le plus petit poids). Pour un graphe non orienté, chaque arc apparaît dans la liste de ses deux extrémités
+ * \complexite O(V+E+E log d) où d est le degré maximal
+ */
+G_GrapheFige G_figer(G_Graphe g);
+
+/**
+ * \brief Retourne les voisins d'un sommet d'un graphe figé, sans allocation ni copie
+ * \param pgf Pointeur vers le graphe figé
+ * \param id L'id du sommet
+ * \param pnbVoisins Pointeur vers l'entier qui reçoit le nombre de voisins
+ * \return Un pointeur vers le premier voisin (tableau interne, à ne pas libérer), NULL si le sommet n'a pas de voisin ou si l'id n'est pas indexable
+ * \complexite O(1)
+ */
+const unsigned int* G_figeVoisins(const G_GrapheFige* pgf, unsigned int id, unsigned int* pnbVoisins);
+
+/**
+ * \brief Retourne le nombre de voisins d'un sommet d'un graphe figé
+ * \param pgf Pointeur vers le graphe figé
+ * \param id L'id du sommet
+ * \return Le degré du sommet (0 si l'id n'est pas indexable)
+ * \complexite O(1)
+ */
+unsigned int G_figeDegre(const G_GrapheFige* pgf, unsigned int id);
+
+/**
+ * \brief Vérifie si un arc est présent dans un graphe figé
+ * \param pgf Pointeur vers le graphe figé
+ * \param idSrc L'id du sommet source
+ * \param idDest L'id du sommet destination
+ * \return true si l'arc est présent (dans un sens ou dans l'autre pour un graphe non orienté), false sinon
+ * \complexite O(log d) où d est le degré de idSrc
+ */
+bool G_figeArcPresent(const G_GrapheFige* pgf, unsigned int idSrc, unsigned int idDest);
+
+/**
+ * \brief Écrit un graphe figé au format binaire dans un flux (à la position courante)
+ * \param pgf Pointeur vers le graphe figé
+ * \param flux Flux ouvert en écriture binaire
+ * \return 0 en cas de succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_FICHIER_ERREUR
+ */
+int G_ecrireFige(const G_GrapheFige* pgf, FILE* flux);
+
+/**
+ * \brief Lit un graphe figé au format binaire directement dans une zone mémoire, sans copie : les tableaux du graphe figé pointent dans la zone
+ * \param zone Début des données (aligné sur 4 octets)
+ * \param taille Nombre d'octets disponibles à partir de zone
+ * \param pgf Pointeur vers le graphe figé à remplir (zone et tailleZone sont mis à NULL et 0 : la zone reste à l'appelant)
+ * \param ptailleLue Pointeur vers l'entier qui reçoit le nombre d'octets occupés par le graphe
+ * \return 0 en cas de succès, -1 en cas d'erreur (signature, version, ordre des octets, taille incorrects, positions non croissantes
+ * ou voisin inconnu). Dans ce cas la variable errno contient le code d'erreur : G_FICHIER_ERREUR
+ * \warning Les tableaux ne doivent pas être modifiés, ni utilisés après la libération de la zone
+ * \complexite O(nbIds + nbEntrees) (vérification des positions et des voisins, sans copie)
+ */
+int G_lireFige(const void* zone, size_t taille, G_GrapheFige* pgf, size_t* ptailleLue);
+
+/**
+ * \brief Sauvegarde un graphe figé dans un fichier binaire (voir G_ecrireFige)
+ * \param pgf Pointeur vers le graphe figé
+ * \param nomFichier Chemin du fichier (remplacé s'il existe)
+ * \return 0 en cas de succès, -1 en cas d'erreur. Dans ce cas la variable errno contient le code d'erreur : G_FICHIER_ERREUR
+ */
+int G_sauvegarder(const G_GrapheFige* pgf, const char* nomFichier);
+
+/**
+ * \brief Charge un graphe figé sauvegardé par G_sauvegarder. Le fichier est projeté en mémoire (mmap, lecture seule) et
+ * les tableaux sont utilisés en place, sans allocation par élément
+ * \param nomFichier Chemin du fichier
+ * \return Le graphe figé, à libérer par G_libererFige. En cas d'erreur, le graphe figé retourné est vide et la variable errno contient le code d'erreur : G_FICHIER_ERREUR
+ * \complexite O(nbIds + nbEntrees) pour la vérification des tableaux, sans allocation ni copie
+ */
+G_GrapheFige G_charger(const char* nomFichier);
+
+/**
+ * \brief Libère la mémoire d'un graphe figé (ou supprime la projection du fichier pour un graphe chargé par G_charger)
+ * \param pgf Pointeur vers le graphe figé
+ */
+void G_libererFige(G_GrapheFige* pgf);
+
+#endif
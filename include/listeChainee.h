@@ -60,6 +60,17 @@ int LC_estVide(LC_ListeChainee);
  */
 void LC_ajouter(LC_ListeChainee*,void*,CLC_FonctionCopier);
 
+/**
+ * \fn LC_ajouterPrendre(LC_ListeChainee*,void*)
+ * \brief Fonction d'ajout d'un élément en tête de liste, sans copie
+ * \attention la liste devient propriétaire de l'élément (qui n'est pas dupliqué)
+ * \post errno=LC_ERREUR_MEMOIRE si pas assez de mémoire (l'élément reste alors à l'appelant)
+ *
+ * \param LC_ListeChainee* pl, la liste chaînée
+ * \param void* element, un pointeur vers l'élément alloué à ranger
+ */
+void LC_ajouterPrendre(LC_ListeChainee*,void*);
+
 /**
  * \fn LC_obtenirElement(LC_ListeChainee)
  * \brief Fonction qui retourne l'élément qui se trouve en tête de liste
@@ -113,6 +124,17 @@ void LC_fixerElement(LC_ListeChainee*,void*,CLC_FonctionCopier,CLC_FonctionLiber
  */
 void LC_supprimerTete(LC_ListeChainee*, CLC_FonctionLiberer);
 
+/**
+ * \fn LC_supprimerTetePrendre(LC_ListeChainee*)
+ * \brief Fonction qui supprime la tête de liste et rend son élément
+ * \pre la liste doit être non vide 
+ * \attention l'élément n'est ni dupliqué ni supprimé : l'appelant en devient propriétaire
+ *
+ * \param LC_ListeChainee* pl
+ * \return void*
+ */
+void* LC_supprimerTetePrendre(LC_ListeChainee*);
+
 /**
  * \fn LC_supprimer(LC_ListeChainee*,CLC_FonctionLiberer)
  * \brief Fonction qui permet de supprimer une liste en profondeur, c'est-à-dire que tous les éléments de la collection sont supprimés
@@ -1,10 +1,25 @@
 /**
  * \file tableHachage.h
- * \brief table de hachage utilisant les listes chaînées.
+ * \brief table de hachage à adressage ouvert (sondage linéaire).
  * \author Nicolas Delestre
- * \version 1.0
+ * \version 2.0
  * \date 2025
  *
+ * Réentrance : le module n'a aucun état global, chaque table porte ses propres fonctions de
+ * copie, de libération, de comparaison et de hachage. Des tables distinctes peuvent donc être
+ * utilisées en même temps par des threads différents.
+ *
+ * Accès concurrents à une même table :
+ *   - les fonctions de consultation (TH_estVide, TH_taille, TH_contient, TH_valeur, TH_cles)
+ *     ne modifient pas la table : plusieurs threads peuvent les appeler en même temps,
+ *     pourvu que les fonctions de copie et de comparaison soient elles-mêmes réentrantes ;
+ *   - TH_inserer, TH_supprimer, TH_reserver, TH_reinitialiser et TH_vider modifient la table (et peuvent réallouer les cases) :
+ *     l'appelant doit les exclure de tout autre accès, par exemple avec un verrou lecteurs/rédacteur.
+ *
+ * Les erreurs sont signalées dans errno, propre à chaque thread.
+ *
+ * Compilé avec -DTH_STATISTIQUES, le module affiche sur stderr les statistiques de chaque table
+ * non vide au moment où elle est détruite (TH_vider), pour repérer les tables dont le hachage dégénère.
  */
 
 #ifndef __TABLEHACHAGE_H__
@@ -12,32 +27,93 @@
 
 #include <stdbool.h>
 #include <stddef.h> 
-#include "listeChainee.h"
+#include <stdint.h>
+#include <stdio.h>
 #include "copieLiberationComparaison.h" 
 
 
-#define TH_TAILLE_TABLE 256
+#define TH_CAPACITE_INITIALE 16 /* nombre de cases allouées au premier ajout (toujours une puissance de 2) */
+#define TH_TAUX_REMPLISSAGE_MAX 0.75 /* la capacité double dès que nbElements dépasserait capacite * TH_TAUX_REMPLISSAGE_MAX */
+
+#define TH_TAILLE_HISTOGRAMME 16 /* nombre de classes de l'histogramme des distances de sondage */
 
 #define TH_MEMOIRE_ERREUR          1
 #define TH_CLE_ABSENTE_ERREUR       2  
 #define TH_CLE_DEJA_PRESENTE_INFO   3  
 
+/**
+ * \brief Fonction de hachage des clés : calcule le haché des tailleCle octets pointés par pcle.
+ * Deux clés égales pour comparerCle doivent avoir le même haché. Comme la table ne garde que
+ * les bits de poids faible (capacité puissance de 2), ceux-ci doivent être bien répartis.
+ */
+typedef size_t (*TH_FonctionHachage) (void* pcle, size_t tailleCle);
+
+/**
+ * \struct TH_Case
+ * \brief Case de la table : vide si pcle vaut NULL.
+ */
+typedef struct {
+  void*  pcle;    /* copie de la clé, NULL si la case est vide */
+  void*  pvaleur; /* copie de la valeur */
+  size_t hache;   /* haché de la clé, conservé pour les agrandissements et pour éviter des comparaisons */
+} TH_Case;
+
 /**
  * \struct TH_TableHachage
- * \brief Dictionnaire générique fondé sur un tableau de listes chaînées.
+ * \brief Dictionnaire générique fondé sur un tableau contigu de cases, avec sondage linéaire.
+ * Les suppressions décalent les cases suivantes (pas de marque de suppression) et la capacité double
+ * automatiquement : les recherches restent en O(1) en moyenne, quel que soit le nombre d'éléments.
  * \warning les clés sont obligatoires de taille fixe (tailleCle).
+ * En mode « en ligne » (TH_tableHachageEnLigne), les clés et les valeurs sont rangées par valeur
+ * dans le tableau donnees, sans aucune allocation par élément.
+ * \warning la structure est copiée lors des passages par valeur : seule la table passée par adresse
+ *          aux fonctions de modification reste à jour.
  */
 typedef struct {
-  LC_ListeChainee      table[TH_TAILLE_TABLE]; 
+  TH_Case*             cases;                  /* tableau de capacite cases (NULL tant que la table n'a jamais rien contenu) */
+  unsigned int         capacite;               /* 0 ou une puissance de 2 */
   size_t               tailleCle;              
   CLC_FonctionCopier   copierCle;              
   CLC_FonctionLiberer  libererCle;             
   CLC_FonctionComparer comparerCle;            
   CLC_FonctionCopier   copierValeur;           
   CLC_FonctionLiberer  libererValeur;          
+  TH_FonctionHachage   hacher;                 /* jamais NULL (TH_hacherOctets par défaut) */
+  bool                 enLigne;                /* true : clés et valeurs rangées dans donnees, cases reste NULL */
+  size_t               tailleValeur;           /* en ligne : taille en octets des valeurs (0 pour un ensemble) */
+  size_t               tailleCase;             /* en ligne : taille d'une case de donnees (clé, valeur puis haché sur 32 bits) */
+  size_t               decalageValeur;         /* en ligne : position de la valeur dans la case */
+  size_t               decalageHache;          /* en ligne : position du haché dans la case (0 marque une case vide) */
+  unsigned char*       donnees;                /* en ligne : tableau de capacite cases de tailleCase octets */
   unsigned int         nbElements;             
 } TH_TableHachage;
 
+/**
+ * \struct TH_Statistiques
+ * \brief Mesures de l'état d'une table (voir TH_statistiques).
+ * La distance de sondage d'une clé est le nombre de cases qui séparent sa case idéale (donnée par son haché)
+ * de la case qui la contient : une recherche réussie examine distance + 1 cases.
+ */
+typedef struct {
+  unsigned int nbElements;
+  unsigned int capacite;
+  double       tauxRemplissage;                      /* nbElements / capacite (0 si la table n'a pas de case) */
+  unsigned int sondageMax;                           /* plus grande distance de sondage */
+  double       sondageMoyen;                         /* distance de sondage moyenne */
+  unsigned int histogramme[TH_TAILLE_HISTOGRAMME];   /* nombre de clés par distance, la dernière classe regroupe les distances >= TH_TAILLE_HISTOGRAMME-1 */
+  size_t       octetsUtilises;                       /* cases, plus les copies des clés hors ligne (la taille des valeurs copiées par copierValeur est inconnue) */
+} TH_Statistiques;
+
+/**
+ * \struct TH_Iterateur
+ * \brief Curseur sur les paires d'une table, qui lit directement les cases (ni allocation, ni copie).
+ * \warning Le curseur n'est plus valide dès que la table est modifiée.
+ */
+typedef struct {
+  const TH_TableHachage* ptableHachage; /* table parcourue */
+  unsigned int           prochaineCase; /* indice de la case à examiner au prochain pas */
+} TH_Iterateur;
+
 /**
  * \brief Crée une table de hachage vide.
  *
@@ -47,16 +123,44 @@ typedef struct {
  * \param tailleCle     Taille en octets des clés (utilisée pour le hachage).
  * \param copierValeur  Fonction de copie des valeurs (doit allouer un duplicata).
  * \param libererValeur Fonction de libération des valeurs.
- * \return Une table de hachage initialisée et vide.
+ * \param hacher        Fonction de hachage des clés, NULL pour utiliser TH_hacherOctets.
+ * \return Une table de hachage initialisée et vide (aucune allocation n'est faite avant le premier ajout).
  *
- * \pre Toutes les fonctions doivent être non NULL ; \c tailleCle > 0.
+ * \pre Toutes les fonctions, sauf \c hacher, doivent être non NULL ; \c tailleCle > 0.
  */
 TH_TableHachage TH_tableHachage(CLC_FonctionCopier copierCle,
                                 CLC_FonctionLiberer libererCle,
                                 CLC_FonctionComparer comparerCle,
                                 size_t tailleCle,
                                 CLC_FonctionCopier copierValeur,
-                                CLC_FonctionLiberer libererValeur);
+                                CLC_FonctionLiberer libererValeur,
+                                TH_FonctionHachage hacher);
+
+/**
+ * \brief Crée une table de hachage vide dont les clés et les valeurs, de taille fixe et sans pointeur
+ *        (entiers, réels, coordonnées...), sont rangées par valeur dans les cases.
+ *
+ * \param copierCle     Fonction de copie des clés, utilisée seulement pour fournir des copies (TH_cles).
+ * \param libererCle    Fonction de libération de ces copies.
+ * \param tailleCle     Taille en octets des clés.
+ * \param copierValeur  Fonction de copie des valeurs, utilisée seulement pour fournir des copies (TH_valeur).
+ * \param libererValeur Fonction de libération de ces copies.
+ * \param tailleValeur  Taille en octets des valeurs (0 si les valeurs ne sont jamais lues, comme pour un ensemble).
+ * \param hacher        Fonction de hachage des clés, NULL pour utiliser TH_hacherOctets.
+ * \return Une table de hachage initialisée et vide.
+ *
+ * \note Les clés et les valeurs sont copiées avec memcpy et les clés comparées avec memcmp : aucune
+ *       allocation n'est faite à l'insertion, et une case n'occupe que la taille de la clé, de la valeur
+ *       et de 4 octets de haché (16 octets pour une coordonnée et un float).
+ * \pre Les octets de remplissage éventuels des clés doivent être initialisés ; \c tailleCle > 0.
+ */
+TH_TableHachage TH_tableHachageEnLigne(CLC_FonctionCopier copierCle,
+                                       CLC_FonctionLiberer libererCle,
+                                       size_t tailleCle,
+                                       CLC_FonctionCopier copierValeur,
+                                       CLC_FonctionLiberer libererValeur,
+                                       size_t tailleValeur,
+                                       TH_FonctionHachage hacher);
 
 /**
  * \brief Indique si la table de hachage est vide.
@@ -83,6 +187,15 @@ unsigned int TH_taille(TH_TableHachage tableHachage);
  */
 bool TH_contient(TH_TableHachage tableHachage, void* pcle);
 
+/**
+ * \brief Identique à TH_contient, la table étant passée par adresse (aucune copie de la structure).
+ *
+ * \param ptableHachage Pointeur vers la table de hachage consultée (non modifiée).
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return \c true si la clé est trouvée, \c false sinon.
+ */
+bool TH_contientRef(const TH_TableHachage* ptableHachage, void* pcle);
+
 /**
  * \brief Insère ou met à jour une paire clé/valeur.
  *
@@ -94,9 +207,29 @@ bool TH_contient(TH_TableHachage tableHachage, void* pcle);
  *  - Si la clé n’existait pas, une nouvelle paire est ajoutée (\c errno=0).
  *  - Si la clé existait, l’ancienne valeur est libérée puis remplacée
  *    (\c errno=TH_CLE_DEJA_PRESENTE_INFO).
+ *  - En cas de manque de mémoire (copie ou agrandissement), la table n'est pas modifiée
+ *    (\c errno=TH_MEMOIRE_ERREUR).
+ * \complexite O(1) en moyenne (amortie pour les agrandissements)
  */
 void TH_inserer(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur);
 
+/**
+ * \brief Insère ou met à jour une paire clé/valeur en prenant possession de la clé et de la valeur.
+ *
+ * \param ptableHachage Pointeur vers la table de hachage à modifier.
+ * \param pcle    Clé allouée comme par copierCle : elle appartient ensuite à la table.
+ * \param pvaleur Valeur allouée comme par copierValeur : elle appartient ensuite à la table.
+ *
+ * \post
+ *  - Comme TH_inserer, sans aucune copie : la table range les pointeurs reçus.
+ *  - Si la clé existait, la table garde sa clé et libère celle reçue (libererCle).
+ *  - En mode en ligne, les octets sont rangés dans la case puis les blocs reçus sont libérés.
+ *  - En cas de manque de mémoire (agrandissement), la table n'est pas modifiée et l'appelant reste
+ *    propriétaire de la clé et de la valeur (\c errno=TH_MEMOIRE_ERREUR).
+ * \complexite O(1) en moyenne, sans copie
+ */
+void TH_insererPrendre(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur);
+
 /**
  * \brief Supprime une paire clé/valeur.
  *
@@ -109,6 +242,18 @@ void TH_inserer(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur);
  */
 void TH_supprimer(TH_TableHachage* ptableHachage, void* pcle);
 
+/**
+ * \brief Supprime une paire clé/valeur et rend sa valeur à l'appelant.
+ *
+ * \param ptableHachage Pointeur vers la table de hachage à modifier.
+ * \param pcle Pointeur vers la clé de la paire à supprimer.
+ * \return
+ *  - La valeur rangée (à libérer avec \c libererValeur), sans copie ; seule la clé est libérée (\c errno=0).
+ *    En mode en ligne, la valeur n'existe que dans la case : c'est une copie par \c copierValeur.
+ *  - \c NULL si la clé est absente (\c errno=TH_CLE_ABSENTE_ERREUR).
+ */
+void* TH_supprimerPrendre(TH_TableHachage* ptableHachage, void* pcle);
+
 /**
  * \brief Retourne une copie de la valeur associée à une clé.
  *
@@ -123,6 +268,58 @@ void TH_supprimer(TH_TableHachage* ptableHachage, void* pcle);
  */
 void* TH_valeur(TH_TableHachage tableHachage, void* pcle);
 
+/**
+ * \brief Identique à TH_valeur, la table étant passée par adresse (aucune copie de la structure).
+ *
+ * \param ptableHachage Pointeur vers la table de hachage consultée (non modifiée).
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return Une copie de la valeur, ou \c NULL si la clé est absente (voir TH_valeur).
+ */
+void* TH_valeurRef(const TH_TableHachage* ptableHachage, void* pcle);
+
+/**
+ * \brief Retourne la valeur associée à une clé, sans la copier.
+ *
+ * \param tableHachage La table de hachage consultée.
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return
+ *  - Un pointeur vers la valeur rangée dans la table si la clé est présente (\c errno=0).
+ *  - \c NULL si la clé est absente (\c errno=TH_CLE_ABSENTE_ERREUR).
+ *
+ * \warning La valeur appartient à la table : elle ne doit être ni modifiée ni libérée, et le
+ *          pointeur n'est plus valide après la prochaine modification de la table (TH_inserer,
+ *          TH_supprimer, TH_vider).
+ * \complexite O(1) en moyenne, sans allocation
+ */
+const void* TH_valeurEmpruntee(TH_TableHachage tableHachage, void* pcle);
+
+/**
+ * \brief Identique à TH_valeurEmpruntee, la table étant passée par adresse (aucune copie de la structure).
+ *
+ * \param ptableHachage Pointeur vers la table de hachage consultée (non modifiée).
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return Un pointeur vers la valeur rangée dans la table, ou \c NULL si la clé est absente.
+ * \complexite O(1) en moyenne, sans allocation ni copie
+ */
+const void* TH_valeurEmprunteeRef(const TH_TableHachage* ptableHachage, void* pcle);
+
+/**
+ * \brief Retourne la valeur associée à une clé, pour la modifier sur place.
+ *
+ * \param ptableHachage Pointeur vers la table de hachage.
+ * \param pcle Pointeur vers la clé recherchée.
+ * \return
+ *  - Un pointeur vers la valeur rangée dans la table si la clé est présente (\c errno=0).
+ *  - \c NULL si la clé est absente (\c errno=TH_CLE_ABSENTE_ERREUR).
+ *
+ * \note Mettre à jour une valeur de taille fixe (un float, une coordonnée...) en écrivant dans
+ *       la valeur pointée évite la copie et la libération faites par TH_inserer.
+ * \warning La valeur ne doit pas être libérée, et le pointeur n'est plus valide après la prochaine
+ *          modification de la table (TH_inserer, TH_supprimer, TH_vider).
+ * \complexite O(1) en moyenne, sans allocation
+ */
+void* TH_referenceValeur(TH_TableHachage* ptableHachage, void* pcle);
+
 /**
  * \brief Retourne une liste contenant toutes les clés de la table de hachage.
  *
@@ -136,14 +333,109 @@ void* TH_valeur(TH_TableHachage tableHachage, void* pcle);
  */
 void** TH_cles(TH_TableHachage tableHachage);
 
+/**
+ * \brief Crée un curseur sur les paires clé/valeur d'une table.
+ *
+ * \param ptableHachage Pointeur vers la table parcourue (qui doit rester en place pendant le parcours).
+ * \return Le curseur, positionné avant la première paire.
+ * \complexite O(1), sans allocation
+ */
+TH_Iterateur TH_iterateur(const TH_TableHachage* ptableHachage);
+
+/**
+ * \brief Avance le curseur et donne la paire suivante.
+ *
+ * \param pit Pointeur vers le curseur.
+ * \param ppcle Reçoit un pointeur vers la clé rangée dans la table (peut être NULL).
+ * \param ppvaleur Reçoit un pointeur vers la valeur rangée dans la table (peut être NULL).
+ * \return \c true si une paire a été donnée, \c false si toutes les paires ont été parcourues.
+ *
+ * \note L'ordre des paires n'est pas garanti (dépend de la table de hachage).
+ * \warning La clé et la valeur appartiennent à la table : elles ne doivent être ni modifiées ni libérées.
+ * \complexite O(1) en moyenne, O(capacite) pour le parcours complet
+ */
+bool TH_suivant(TH_Iterateur* pit, const void** ppcle, const void** ppvaleur);
+
+
+/**
+ * \brief Mesure le remplissage et la qualité du hachage d'une table (ou d'un dictionnaire, ou d'un ensemble).
+ *
+ * \param ptableHachage Pointeur vers la table examinée (non modifiée).
+ * \return Les statistiques de la table.
+ * \complexite O(capacite), sans allocation
+ */
+TH_Statistiques TH_statistiques(const TH_TableHachage* ptableHachage);
+
+/**
+ * \brief Écrit les statistiques d'une table sur une ligne.
+ *
+ * \param stats Les statistiques (voir TH_statistiques).
+ * \param flux Flux ouvert en écriture.
+ */
+void TH_afficherStatistiques(TH_Statistiques stats, FILE* flux);
+
+/**
+ * \brief Prépare la table à recevoir n éléments sans redimensionnement.
+ *
+ * \param ptableHachage Pointeur vers la table de hachage.
+ * \param n Nombre d'éléments attendus.
+ *
+ * \post La capacité permet de ranger n éléments sans dépasser TH_TAUX_REMPLISSAGE_MAX ; elle ne diminue
+ *       jamais. En cas de manque de mémoire, ou si n demande une capacité qui ne tient pas dans un
+ *       unsigned int, \c errno=TH_MEMOIRE_ERREUR et la table est inchangée.
+ * \complexite O(capacite) si la table est agrandie, O(1) sinon
+ */
+void TH_reserver(TH_TableHachage* ptableHachage, unsigned int n);
+
+/**
+ * \brief Supprime toutes les paires en conservant le tableau des cases.
+ *
+ * \param ptableHachage Pointeur vers la table de hachage.
+ *
+ * \post Toutes les paires sont supprimées et libérées, \c nbElements=0 ; la capacité est inchangée,
+ *       les ajouts suivants n'allouent rien tant qu'elle suffit. Le tableau des cases n'est libéré
+ *       que par TH_vider.
+ * \complexite O(capacite) : à préférer à TH_vider pour une table remplie de nouveau à chaque usage
+ */
+void TH_reinitialiser(TH_TableHachage* ptableHachage);
 
 /**
  * \brief Vide complètement la table de hachage.
  *
  * \param ptableHachage Pointeur vers la table de hachage à vider.
  *
- * \post Toutes les paires sont supprimées et libérées, \c nbElements=0.
+ * \post Toutes les paires sont supprimées et libérées, ainsi que le tableau des cases, \c nbElements=0.
+ *       La table reste utilisable.
  */
 void TH_vider(TH_TableHachage* ptableHachage);
 
+/**
+ * \brief Mélange les 64 bits d'un entier (finaliseur de MurmurHash3) : chaque bit du
+ * résultat dépend de tous les bits de l'entrée.
+ *
+ * \param x L'entier à mélanger.
+ * \return L'entier mélangé (0 donne 0).
+ */
+uint64_t TH_melanger(uint64_t x);
+
+/**
+ * \brief Hachage par défaut : mélange 64 bits des tailleCle octets de la clé, par blocs de 8 octets.
+ *
+ * \param pcle Pointeur vers la clé.
+ * \param tailleCle Taille en octets de la clé.
+ * \return Le haché de la clé.
+ * \warning les octets de remplissage d'une structure sont pris en compte : ils doivent être
+ *          initialisés ou la clé doit utiliser un hachage spécialisé.
+ */
+size_t TH_hacherOctets(void* pcle, size_t tailleCle);
+
+/**
+ * \brief Hachage spécialisé pour les clés de type int (tailleCle est ignorée).
+ *
+ * \param pcle Pointeur vers un int.
+ * \param tailleCle Ignorée (sizeof(int)).
+ * \return Le haché de l'entier.
+ */
+size_t TH_hacherEntier(void* pcle, size_t tailleCle);
+
 #endif 
@@ -24,19 +24,48 @@
 /**
  * \struct T_Terrain
  * \brief 
+ * \note Les fonctions de consultation (T_cheminExiste, T_sontConnectees, T_iterateurVoisins...) ne modifient
+ *       pas le terrain : elles peuvent être appelées par plusieurs threads à la fois, tant qu'aucun ne le modifie.
  */
 typedef struct T_Terrain {
     unsigned int taille;           /**< Taille du terrain (largeur/hauteur) */
     G_Graphe chemins;              /**< Graphe non-orienté*/
+    bool estFige;                  /**< true si les chemins ont été figés (voir T_figer) */
+    G_GrapheFige cheminsFiges;     /**< Instantané CSR des chemins, valide si estFige */
+    float coutMinimal;             /**< Plus petit coût de passage (1 tant qu'aucun chemin n'est pondéré) */
+    bool estGrille;                /**< true si le terrain a été créé par T_terrainGrille : les passages sont dans ouvertures et chemins reste vide */
+    unsigned char* ouvertures;     /**< Grille : 2 bits par case, passage vers la case de droite puis vers la case du dessous */
+    unsigned int* composantes;     /**< Union-find des cases (indice : numéro de case) donnant leur composante connexe. Aplati une fois le terrain figé
+                                        (chaque case pointe sur son représentant). NULL en cas de manque de mémoire */
+    unsigned char* rangsComposantes; /**< Rangs de l'union-find, NULL une fois le terrain figé */
+    void* zone;                    /**< Projection du fichier chargé par T_charger, qui contient les passages et les composantes (NULL sinon) */
+    size_t tailleZone;             /**< Taille de la projection */
     CO_Coordonnee positionDepart;
     DI_Direction directionDepart;    
     THE_Ensemble positionsObjectifs;    /**< Ensemble de Coordonnée*/
 } T_Terrain;
 
+/**
+ * \struct T_IterateurVoisins
+ * \brief Curseur sur les cases accessibles depuis une case, quel que soit le stockage du terrain (voir T_iterateurVoisins)
+ */
+typedef struct {
+    G_IterateurVoisins voisinsGraphe;  /**< Curseur dans le graphe (terrain qui n'est pas une grille) */
+    unsigned int voisinsGrille[4];     /**< Cases accessibles (grille) */
+    unsigned int nbVoisinsGrille;      /**< Nombre de cases de voisinsGrille */
+    unsigned int indiceGrille;         /**< Prochaine case de voisinsGrille à retourner */
+} T_IterateurVoisins;
+
 /* -------------------------------------------------------------------------- */
 /*                            PARTIE PUBLIQUE                                 */
 /* -------------------------------------------------------------------------- */
 
+#define T_TERRAIN_FIGE_ERREUR 1
+#define T_COUT_ERREUR 2
+#define T_TERRAIN_GRILLE_ERREUR 3
+#define T_FICHIER_ERREUR 4
+#define T_CHEMIN_HORS_TERRAIN_ERREUR 5
+
 /**
  * \brief Création d'un terrain vide.
  * \param h taille du terrain à initialiser
@@ -44,6 +73,15 @@ typedef struct T_Terrain {
  */
 T_Terrain T_terrain(unsigned int h);
 
+/**
+ * \brief Création d'un terrain vide stocké en grille : 2 bits par case (passage vers la droite, passage vers le bas),
+ * soit environ 25 Mo pour 10000x10000 cases. Toutes les fonctions T_ s'utilisent de la même façon sur les deux stockages,
+ * mais les chemins d'une grille relient uniquement des cases adjacentes et n'ont pas de coût.
+ * \param h taille du terrain à initialiser
+ * \return Le terrain vide. En cas de manque de mémoire, errno=G_MEMOIRE_ERREUR et le terrain retourné est de taille 0
+ */
+T_Terrain T_terrainGrille(unsigned int h);
+
 /**
  * \brief Savoir si un chemin existe entre les coordonnées adjacentes a et b
  * \param t le terrain dont on obtient les positions
@@ -53,6 +91,36 @@ T_Terrain T_terrain(unsigned int h);
  */
 bool T_cheminExiste(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b);
 
+/**
+ * \brief Identique à T_cheminExiste, le terrain étant passé par adresse (aucune copie de la structure)
+ * \param t pointeur vers le terrain (non modifié)
+ * \param a la coordonnée a
+ * \param b la coordonnée b
+ * \return booléen indiquant si un chemin existe
+ */
+bool T_cheminExisteRef(const T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b);
+
+/**
+ * \brief Savoir si deux coordonnées sont reliées par une suite de chemins (même composante connexe)
+ * \param t le terrain
+ * \param a la coordonnée a
+ * \param b la coordonnée b
+ * \return false si aucun trajet ne relie a et b (ou si l'une des deux est hors du terrain), true sinon
+ * (et aussi si les composantes n'ont pas pu être calculées faute de mémoire)
+ * \note Les composantes sont tenues à jour à chaque ajout de chemin. La fonction ne modifie pas le terrain :
+ * O(1) sur un terrain figé ou chargé, O(log n) sinon
+ */
+bool T_sontConnectees(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b);
+
+/**
+ * \brief Identique à T_sontConnectees, le terrain étant passé par adresse (aucune copie de la structure)
+ * \param t pointeur vers le terrain (non modifié)
+ * \param a la coordonnée a
+ * \param b la coordonnée b
+ * \return false si aucun trajet ne relie a et b, true sinon
+ */
+bool T_sontConnecteesRef(const T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b);
+
 /**
  * \brief Savoir si une coordonnée correspond à celle d'un des objectifs
  * \param t le terrain dont on obtient les positions
@@ -61,6 +129,14 @@ bool T_cheminExiste(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b);
  */
 bool T_estUnObjectif(T_Terrain t, CO_Coordonnee c);
 
+/**
+ * \brief Identique à T_estUnObjectif, le terrain étant passé par adresse (aucune copie de la structure)
+ * \param t pointeur vers le terrain (non modifié)
+ * \param c la coordonnée
+ * \return booléen indiquant si c'est une coordonnée d'objectif
+ */
+bool T_estUnObjectifRef(const T_Terrain* t, CO_Coordonnee c);
+
 /**
  * \brief Obtenir la taille du terrain
  * \param t le terrain dont on obtient la taille
@@ -101,9 +177,88 @@ void T_ajouterObjectif(T_Terrain* t, CO_Coordonnee c);
  * \param t terrain à modifier
  * \param coordA la coordonnée du point A
  * \param coordA la coordonnée du point B
+ * \post Si le terrain est figé, il n'est pas modifié et errno=T_TERRAIN_FIGE_ERREUR.
+ *       Si A ou B sort du terrain, il n'est pas modifié et errno=T_CHEMIN_HORS_TERRAIN_ERREUR.
+ *       Pour une grille, si A et B ne sont pas des cases adjacentes du terrain, il n'est pas modifié et errno=T_TERRAIN_GRILLE_ERREUR
  */
 void T_ajouterChemin(T_Terrain* terrain, CO_Coordonnee coordA, CO_Coordonnee coordB);
 
+/**
+ * \brief Ajouter dans le terrain un chemin entre un point A et un point B (adjacents), avec son coût de passage
+ * (pente, encombrement...). Les chemins ajoutés sans coût valent 1. Si le chemin existe déjà, il garde le plus faible des deux coûts.
+ * \param terrain terrain à modifier
+ * \param coordA la coordonnée du point A
+ * \param coordB la coordonnée du point B
+ * \param cout le coût de passage, strictement positif
+ * \post Si le terrain est figé, il n'est pas modifié et errno=T_TERRAIN_FIGE_ERREUR.
+ *       Si le coût n'est pas strictement positif, il n'est pas modifié et errno=T_COUT_ERREUR.
+ *       Si A ou B sort du terrain, il n'est pas modifié et errno=T_CHEMIN_HORS_TERRAIN_ERREUR.
+ *       Si le terrain est une grille, il n'est pas modifié et errno=T_TERRAIN_GRILLE_ERREUR.
+ */
+void T_ajouterCheminPondere(T_Terrain* terrain, CO_Coordonnee coordA, CO_Coordonnee coordB, float cout);
+
+/**
+ * \brief Ajouter dans le terrain un lot de chemins, le i-ème reliant coordsA[i] et coordsB[i] (voir G_ajouterArcs).
+ * Les doublons (y compris dans l'autre sens) sont ignorés.
+ * \param terrain terrain à modifier
+ * \param coordsA les coordonnées des premières extrémités
+ * \param coordsB les coordonnées des secondes extrémités
+ * \param nb nombre de chemins
+ * \return Le nombre de chemins ignorés parce qu'ils sont invalides ; les autres sont ajoutés
+ * \post Si le terrain est figé, il n'est pas modifié, la fonction retourne nb et errno=T_TERRAIN_FIGE_ERREUR.
+ *       Les chemins dont une extrémité sort du terrain sont ignorés (errno=T_CHEMIN_HORS_TERRAIN_ERREUR).
+ *       Pour une grille, les chemins entre cases non adjacentes sont ignorés (errno=T_TERRAIN_GRILLE_ERREUR).
+ *       En cas de manque de mémoire, aucun chemin n'est ajouté, la fonction retourne nb et errno=G_MEMOIRE_ERREUR.
+ *       Si aucun chemin n'est ignoré, errno=0.
+ */
+unsigned int T_ajouterChemins(T_Terrain* terrain, const CO_Coordonnee coordsA[], const CO_Coordonnee coordsB[], unsigned int nb);
+
+/**
+ * \brief Figer les chemins du terrain : le graphe est compilé en un instantané CSR
+ * (voir G_figer) puis libéré. Les requêtes de voisinage deviennent O(degré) et sans allocation.
+ * \param t terrain à figer
+ * \post En cas de succès, T_ajouterChemin n'est plus permis (errno=T_TERRAIN_FIGE_ERREUR).
+ *       En cas de manque de mémoire, le terrain reste modifiable et errno=G_MEMOIRE_ERREUR.
+ *       Une grille est déjà compacte : elle est seulement marquée comme figée.
+ */
+void T_figer(T_Terrain* t);
+
+/**
+ * \brief Sauvegarder le terrain dans un fichier binaire : taille, stockage, départ, direction, coût minimal, objectifs,
+ * puis les passages (bits de la grille, ou graphe figé au format de G_ecrireFige) et le représentant de la composante connexe de chaque case
+ * \param t le terrain (s'il n'est pas figé, ses chemins sont figés dans un instantané temporaire)
+ * \param nomFichier chemin du fichier (remplacé s'il existe)
+ * \return 0 en cas de succès, -1 en cas d'erreur et errno=T_FICHIER_ERREUR (ou G_MEMOIRE_ERREUR)
+ */
+int T_sauvegarder(T_Terrain t, const char* nomFichier);
+
+/**
+ * \brief Charger un terrain sauvegardé par T_sauvegarder. Le fichier est projeté en mémoire (mmap) et les passages
+ * sont utilisés en place, sans reconstruction ni allocation. Le contenu est seulement vérifié (positions, voisins et
+ * composantes), en un passage linéaire
+ * \param nomFichier chemin du fichier
+ * \return Le terrain, figé (à libérer par T_supprimerTerrain). En cas d'erreur (fichier tronqué ou incohérent),
+ * errno=T_FICHIER_ERREUR et le terrain retourné est de taille 0
+ */
+T_Terrain T_charger(const char* nomFichier);
+
+/**
+ * \brief Crée un curseur sur les cases accessibles depuis une case, sans allocation
+ * \param t pointeur vers le terrain (qui ne doit pas être modifié pendant le parcours)
+ * \param numCase le numéro de la case (voir CO_CoordonneeVersNumeroCase)
+ * \return Le curseur, positionné avant la première case accessible
+ */
+T_IterateurVoisins T_iterateurVoisins(const T_Terrain* t, unsigned int numCase);
+
+/**
+ * \brief Avance le curseur et donne la case accessible suivante
+ * \param pit pointeur vers le curseur
+ * \param pnumCase pointeur vers l'entier qui reçoit le numéro de la case
+ * \param pcout pointeur vers le réel qui reçoit le coût de passage (1 si le chemin n'a pas de coût)
+ * \return true si une case a été donnée, false si toutes les cases accessibles ont été parcourues
+ */
+bool T_voisinSuivant(T_IterateurVoisins* pit, unsigned int* pnumCase, float* pcout);
+
 /**
  * \brief Fixer un objectif dans le terrain.
  * \param t terrain à modifier\param t terrain à modifier
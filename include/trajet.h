@@ -14,6 +14,36 @@
 #include "chemin.h"
 #include "terrain.h"  
 #include "ListeChaineeFile.h"
+#include "TableHachageConcurrente.h"
+
+/* -------------------------------------------------------------------------- */
+/* PARTIE PRIVÉE                                                              */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * \struct TR_PaireCoordonnees
+ * \brief Clé du cache des distances : départ et arrivée d'une recherche.
+ */
+typedef struct {
+    CO_Coordonnee depart;
+    CO_Coordonnee arrivee;
+} TR_PaireCoordonnees;
+
+/**
+ * \brief Cache des distances, partageable entre threads (dictionnaire concurrent paire -> float).
+ */
+typedef THC_Dictionnaire TR_CacheDistances;
+
+/**
+ * \struct TR_EspaceTravail
+ * \brief Tables de travail de l'A* (liste fermée, coûts g et f, parents), réutilisables d'une recherche à l'autre.
+ */
+typedef struct {
+    THE_Ensemble noeudVisites;
+    THD_Dictionnaire coutG;
+    THD_Dictionnaire coutF;
+    THD_Dictionnaire parents;
+} TR_EspaceTravail;
 
 /* -------------------------------------------------------------------------- */
 /* PARTIE PUBLIQUE                                                            */
@@ -35,9 +65,66 @@ CH_Chemin TR_obtenirParcours(T_Terrain terrain, CO_Coordonnee depart, CO_Coordon
  * \param depart Point de départ.
  * \param arrivee Point d'arrivée.
  * \return Le chemin élémentaire entre ces deux points.
+ * \note Réentrante : les tables de la recherche sont propres à l'appel et le terrain n'est que lu.
+ *       Pour des recherches répétées, TR_plusCourtCheminAvecEspace évite de recréer les tables.
+ *       Plusieurs threads peuvent donc chercher des chemins sur le même terrain, tant qu'aucun
+ *       ne le modifie pendant ce temps (T_ajouterChemin, T_figer, T_supprimerTerrain...).
  */
 CH_Chemin TR_plusCourtChemin(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee);
 
+/**
+ * \brief Crée un espace de travail pour des recherches répétées.
+ * \param nbCasesPrevues Nombre de cases qu'une recherche devrait explorer (0 pour ne rien réserver).
+ * \return L'espace de travail, dont les tables sont vides.
+ * \note Après chaque recherche les tables sont vidées mais gardent leurs cases : les recherches
+ *       suivantes n'allouent plus rien tant que la zone explorée ne grandit pas. En contrepartie,
+ *       chaque recherche coûte au moins un parcours de la capacité atteinte.
+ */
+TR_EspaceTravail TR_espaceTravail(unsigned int nbCasesPrevues);
+
+/**
+ * \brief Trouve le plus court chemin entre deux points en utilisant un espace de travail existant.
+ * \param terrain Le terrain.
+ * \param depart Point de départ.
+ * \param arrivee Point d'arrivée.
+ * \param pespace Pointeur vers l'espace de travail, propre au thread appelant.
+ * \return Le chemin élémentaire entre ces deux points (voir TR_plusCourtChemin).
+ */
+CH_Chemin TR_plusCourtCheminAvecEspace(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee,
+                                       TR_EspaceTravail* pespace);
+
+/**
+ * \brief Libère les tables d'un espace de travail.
+ * \param pespace Pointeur vers l'espace de travail.
+ */
+void TR_supprimerEspaceTravail(TR_EspaceTravail* pespace);
+
+/**
+ * \brief Crée un cache des distances vide.
+ * \param nbSegments Nombre de segments du dictionnaire concurrent (0 pour la valeur par défaut).
+ * \return Le cache (sans segment et errno=THC_MEMOIRE_ERREUR en cas de manque de mémoire).
+ * \warning Un cache ne vaut que pour un terrain : il doit être vidé (THC_vider) dès que le terrain change.
+ */
+TR_CacheDistances TR_cacheDistances(unsigned int nbSegments);
+
+/**
+ * \brief Donne le coût du plus court chemin entre deux points, en passant par un cache partagé.
+ * \param terrain Le terrain.
+ * \param depart Point de départ.
+ * \param arrivee Point d'arrivée.
+ * \param pcache Pointeur vers le cache (NULL pour toujours calculer).
+ * \return Le coût du chemin (son nombre de pas sur un terrain non pondéré), INFINITY si l'arrivée n'est pas accessible.
+ * \note Plusieurs threads peuvent appeler la fonction avec le même cache : une distance absente est calculée
+ *       puis rangée avec THC_insererSiAbsent, les distances présentes sont lues sans allocation.
+ */
+float TR_distance(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee, TR_CacheDistances* pcache);
+
+/**
+ * \brief Libère le cache des distances.
+ * \param pcache Pointeur vers le cache, qui ne doit plus être utilisé par aucun thread.
+ */
+void TR_supprimerCacheDistances(TR_CacheDistances* pcache);
+
 /**
  * \brief Détermine l'ordre optimal des points de passage (Voyageur de commerce).
  * \param depart Point de départ.
@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include "FileCirculaire.h"
+
+/* -------------------------------------------------------------------------- */
+/*                 FONCTIONS / VARIABLES PRIVEES AU MODULE                    */
+/* -------------------------------------------------------------------------- */
+
+static unsigned char* FC_case(const FC_FileCirculaire* pfile, unsigned int i) {
+  return pfile->elements + (size_t)i * pfile->tailleElement;
+}
+
+/* Agrandit le tableau à nouvelleCapacite cases (puissance de 2) ; les éléments qui
+   faisaient le tour (début du tableau) sont recopiés juste après l'ancienne fin */
+static bool FC_redimensionner(FC_FileCirculaire* pfile, unsigned int nouvelleCapacite) {
+  unsigned char* elements;
+  unsigned int nbApresTete;
+
+  elements = (unsigned char*)realloc(pfile->elements, (size_t)nouvelleCapacite * pfile->tailleElement);
+  if (elements == NULL) {
+    return false;
+  }
+  pfile->elements = elements;
+  nbApresTete = pfile->capacite - pfile->tete;
+  if (pfile->longueur > nbApresTete) {
+    memcpy(FC_case(pfile, pfile->capacite), FC_case(pfile, 0U),
+           (size_t)(pfile->longueur - nbApresTete) * pfile->tailleElement);
+  }
+  pfile->capacite = nouvelleCapacite;
+  return true;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/*                    FONCTIONS PUBLIQUES DU MODULE                           */
+/* -------------------------------------------------------------------------- */
+
+FC_FileCirculaire FC_file(size_t tailleElement) {
+  FC_FileCirculaire file;
+
+  file.elements = NULL;
+  file.tailleElement = tailleElement;
+  file.capacite = 0U;
+  file.tete = 0U;
+  file.longueur = 0U;
+  return file;
+}
+
+bool FC_estVide(FC_FileCirculaire file) {
+  return file.longueur == 0U;
+}
+
+unsigned int FC_longueur(FC_FileCirculaire file) {
+  return file.longueur;
+}
+
+void FC_enfiler(FC_FileCirculaire* pfile, void* pelement) {
+  if (pfile->longueur == pfile->capacite &&
+      (pfile->capacite > UINT_MAX / 2U ||
+       !FC_redimensionner(pfile, (pfile->capacite == 0U) ? FC_CAPACITE_INITIALE : 2U * pfile->capacite))) {
+    errno = FC_MEMOIRE_ERREUR;
+    return;
+  }
+  memcpy(FC_case(pfile, (pfile->tete + pfile->longueur) & (pfile->capacite - 1U)), pelement, pfile->tailleElement);
+  pfile->longueur += 1U;
+  errno = 0;
+}
+
+bool FC_defiler(FC_FileCirculaire* pfile, void* pelement) {
+  if (pfile->longueur == 0U) {
+    errno = FC_FILE_VIDE_ERREUR;
+    return false;
+  }
+  if (pelement != NULL) {
+    memcpy(pelement, FC_case(pfile, pfile->tete), pfile->tailleElement);
+  }
+  pfile->tete = (pfile->tete + 1U) & (pfile->capacite - 1U);
+  pfile->longueur -= 1U;
+  errno = 0;
+  return true;
+}
+
+const void* FC_tete(const FC_FileCirculaire* pfile) {
+  if (pfile->longueur == 0U) {
+    errno = FC_FILE_VIDE_ERREUR;
+    return NULL;
+  }
+  errno = 0;
+  return FC_case(pfile, pfile->tete);
+}
+
+void FC_reserver(FC_FileCirculaire* pfile, unsigned int n) {
+  unsigned int capacite;
+
+  capacite = (pfile->capacite == 0U) ? FC_CAPACITE_INITIALE : pfile->capacite;
+  while (capacite < n) {
+    if (capacite > UINT_MAX / 2U) {
+      /* n dépasse la plus grande puissance de 2 représentable */
+      errno = FC_MEMOIRE_ERREUR;
+      return;
+    }
+    capacite *= 2U;
+  }
+  if (capacite > pfile->capacite && !FC_redimensionner(pfile, capacite)) {
+    errno = FC_MEMOIRE_ERREUR;
+    return;
+  }
+  errno = 0;
+}
+
+void FC_vider(FC_FileCirculaire* pfile) {
+  free(pfile->elements);
+  pfile->elements = NULL;
+  pfile->capacite = 0U;
+  pfile->tete = 0U;
+  pfile->longueur = 0U;
+  errno = 0;
+}
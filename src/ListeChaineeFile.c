@@ -31,14 +31,34 @@ void LCF_enfiler(LCF_ListeChaineeFile* pfile, void* element) {
   }
 }
 
+void LCF_enfilerPrendre(LCF_ListeChaineeFile* pfile, void* element) {
+  LC_ListeChainee nouvel;
+
+  nouvel = LC_listeChainee();
+  LC_ajouterPrendre(&nouvel, element);
+  if (errno != 0) {
+    return;
+  }
+  if (LCF_estVide(*pfile)) {
+    pfile->teteFile = nouvel;
+  } else {
+    LC_fixerListeSuivante(&(pfile->queueFile), nouvel);
+  }
+  pfile->queueFile = nouvel;
+}
+
 void* LCF_defiler(LCF_ListeChaineeFile* pfile) {
-  void* element;  
+  /* l'élément rangé appartient à la file : le rendre évite une copie suivie d'une libération */
+  return LCF_defilerPrendre(pfile);
+}
+
+void* LCF_defilerPrendre(LCF_ListeChaineeFile* pfile) {
+  void* element;
   if (LCF_estVide(*pfile)) {
     errno = FILE_VIDE_ERREUR;
     return NULL;
   }
-  element = pfile->copierElement(LC_obtenirElement(pfile->teteFile));
-  LC_supprimerTete(&(pfile->teteFile), pfile->supprimerElement);
+  element = LC_supprimerTetePrendre(&(pfile->teteFile));
 
   if (LC_estVide(pfile->teteFile)) {
     pfile->queueFile = pfile->teteFile;
@@ -57,6 +77,6 @@ void* LCF_element(LCF_ListeChaineeFile file) {
 
 void LCF_vider(LCF_ListeChaineeFile* pfile) {
   while (!LCF_estVide(*pfile)) {
-    LCF_defiler(pfile);
+    pfile->supprimerElement(LCF_defilerPrendre(pfile));
   }
 }
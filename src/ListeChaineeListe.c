@@ -1,11 +1,34 @@
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include "ListeChaineeListe.h"
 
+/* Garantit au moins n cases dans le tableau (capacité doublée, jamais diminuée) */
+static bool LCL_agrandir(LCL_Liste* pliste, unsigned int n) {
+  unsigned int capacite;
+  void** elements;
+
+  if (n <= pliste->capacite) {
+    return true;
+  }
+  capacite = (pliste->capacite == 0) ? LCL_CAPACITE_INITIALE : pliste->capacite;
+  while (capacite < n) {
+    capacite *= 2;
+  }
+  elements = realloc(pliste->elements, capacite * sizeof(void*));
+  if (elements == NULL) {
+    return false;
+  }
+  pliste->elements = elements;
+  pliste->capacite = capacite;
+  return true;
+}
+
 LCL_Liste LCL_liste(CLC_FonctionCopier copierElement,
                     CLC_FonctionLiberer supprimerElement) {
   LCL_Liste l;
-  l.liste = LC_listeChainee();
+  l.elements = NULL;
+  l.capacite = 0;
   l.copierElement = copierElement;
   l.supprimerElement = supprimerElement;
   l.longueur = 0;
@@ -13,46 +36,91 @@ LCL_Liste LCL_liste(CLC_FonctionCopier copierElement,
 }
 
 bool LCL_estVide(LCL_Liste liste) {
-  return LC_estVide(liste.liste);
+  return liste.longueur == 0;
 }
 
 int LCL_longueur(LCL_Liste liste) {
   return liste.longueur;
 }
 
+/* Insère une copie de l'élément : le rangement et ses erreurs sont ceux de LCL_insererPrendre */
+static void LCL_insererCopie(LCL_Liste* pliste, void* element, unsigned int position) {
+  void* copie;
+  int erreur;
+
+  copie = pliste->copierElement(element);
+  if (copie == NULL) {
+    errno = LISTE_MEMOIRE_ERREUR;
+    return;
+  }
+  LCL_insererPrendre(pliste, copie, position);
+  if (errno != 0) {
+    erreur = errno;
+    pliste->supprimerElement(copie);
+    errno = erreur;
+  }
+}
+
 void LCL_inserer(LCL_Liste* pliste, void* element, unsigned int position) {
-  LC_ListeChainee cur;           
-  LC_ListeChainee suiv;          
-  unsigned int i;
   if (pliste == NULL) {
     errno = EINVAL;
     return;
   }
-  if (position < 0 || position > (unsigned int)(pliste->longueur)) {
+  LCL_insererCopie(pliste, element, position);
+}
+
+void LCL_ajouterFin(LCL_Liste* pliste, void* element) {
+  if (pliste == NULL) {
+    errno = EINVAL;
+    return;
+  }
+  LCL_insererCopie(pliste, element, (unsigned int)pliste->longueur);
+}
+
+void LCL_insererPrendre(LCL_Liste* pliste, void* element, unsigned int position) {
+  if (pliste == NULL) {
+    errno = EINVAL;
+    return;
+  }
+  if (position > (unsigned int)(pliste->longueur)) {
     errno = POSITION_HORS_BORNES_ERREUR;
     return;
   }
-  if (position == 0) {
-    LC_ajouter(&(pliste->liste), element, pliste->copierElement);
-  } else {
-    cur = pliste->liste;
-    for (i = 0; i < position-1; i++) {
-      cur = LC_obtenirListeSuivante(cur);
-    }
-    suiv = LC_obtenirListeSuivante(cur);
-    LC_ajouter(&suiv, element, pliste->copierElement);
-    LC_fixerListeSuivante(&cur, suiv);
+  if (!LCL_agrandir(pliste, (unsigned int)pliste->longueur + 1)) {
+    errno = LISTE_MEMOIRE_ERREUR;
+    return;
   }
-
+  memmove(&(pliste->elements[position + 1]), &(pliste->elements[position]),
+          ((unsigned int)pliste->longueur - position) * sizeof(void*));
+  pliste->elements[position] = element;
   pliste->longueur++;
   errno = 0;
 }
 
-void LCL_supprimer(LCL_Liste* pliste, unsigned int position) {
-  LC_ListeChainee cur;   
-  LC_ListeChainee suiv;  
-  unsigned int i;
+void* LCL_supprimerPrendre(LCL_Liste* pliste, unsigned int position) {
+  void* element;
+
+  if (pliste == NULL) {
+    errno = EINVAL;
+    return NULL;
+  }
+  if (pliste->longueur == 0) {
+    errno = LISTE_VIDE_ERREUR;
+    return NULL;
+  }
+  if (position >= (unsigned int)pliste->longueur) {
+    errno = POSITION_HORS_BORNES_ERREUR;
+    return NULL;
+  }
+  element = pliste->elements[position];
+  memmove(&(pliste->elements[position]), &(pliste->elements[position + 1]),
+          ((unsigned int)pliste->longueur - position - 1) * sizeof(void*));
+  pliste->longueur--;
+  errno = 0;
+  return element;
+}
 
+void LCL_supprimer(LCL_Liste* pliste, unsigned int position) {
   if (pliste == NULL) {
     errno = EINVAL;
     return;
@@ -62,56 +130,75 @@ void LCL_supprimer(LCL_Liste* pliste, unsigned int position) {
     errno = LISTE_VIDE_ERREUR;
     return;
   }
-  if (position < 0 || position >= (unsigned int)pliste->longueur) {
+  if (position >= (unsigned int)pliste->longueur) {
     errno = POSITION_HORS_BORNES_ERREUR;
     return;
   }
-  if (position == 0) {
-    LC_supprimerTete(&(pliste->liste), pliste->supprimerElement);
-  } else {
-    cur = pliste->liste;
-    for (i = 0; i < position - 1; i++) {
-      cur = LC_obtenirListeSuivante(cur);
-    }
-    suiv = LC_obtenirListeSuivante(cur);
-    LC_supprimerTete(&suiv, pliste->supprimerElement);
-    LC_fixerListeSuivante(&cur, suiv);
-  }
+  pliste->supprimerElement(pliste->elements[position]);
+  memmove(&(pliste->elements[position]), &(pliste->elements[position + 1]),
+          ((unsigned int)pliste->longueur - position - 1) * sizeof(void*));
   pliste->longueur--;
   errno = 0;
 }
 
 void* LCL_element(LCL_Liste liste, unsigned int position) {
-  LC_ListeChainee cur;
-  unsigned int i;
+  const void* pelement;
 
-  if (liste.longueur == 0) {
+  pelement = LCL_elementEmprunte(&liste, position);
+  if (pelement == NULL) {
+    return NULL;
+  }
+  return liste.copierElement((void*)pelement);
+}
+
+const void* LCL_elementEmprunte(const LCL_Liste* pliste, unsigned int position) {
+  if (pliste->longueur == 0) {
     errno = LISTE_VIDE_ERREUR;
     return NULL;
   }
-  if (position < 0 || position > (unsigned int)liste.longueur) {
+  if (position >= (unsigned int)pliste->longueur) {
     errno = POSITION_HORS_BORNES_ERREUR;
     return NULL;
   }
-  cur = liste.liste;
-  for (i = 0; i < position; i++) {
-    cur = LC_obtenirListeSuivante(cur);
+  errno = 0;
+  return pliste->elements[position];
+}
+
+void LCL_reserver(LCL_Liste* pliste, unsigned int n) {
+  if (!LCL_agrandir(pliste, n)) {
+    errno = LISTE_MEMOIRE_ERREUR;
+    return;
   }
   errno = 0;
-  return liste.copierElement(LC_obtenirElement(cur));
 }
 
 LCL_Liste LCL_copier(LCL_Liste liste) {
   LCL_Liste nouvelleListe;
-  nouvelleListe.liste = LC_copier(liste.liste, liste.copierElement);
-  nouvelleListe.copierElement = liste.copierElement;
-  nouvelleListe.supprimerElement = liste.supprimerElement;
-  nouvelleListe.longueur = liste.longueur;
+  nouvelleListe = LCL_liste(liste.copierElement, liste.supprimerElement);
+  if (!LCL_agrandir(&nouvelleListe, (unsigned int)liste.longueur)) {
+    errno = LISTE_MEMOIRE_ERREUR;
+    return nouvelleListe;
+  }
+  for (int i = 0; i < liste.longueur; i++) {
+    nouvelleListe.elements[i] = liste.copierElement(liste.elements[i]);
+    if (nouvelleListe.elements[i] == NULL) {
+      LCL_vider(&nouvelleListe);
+      errno = LISTE_MEMOIRE_ERREUR;
+      return nouvelleListe;
+    }
+    nouvelleListe.longueur++;
+  }
+  errno = 0;
   return nouvelleListe;
 }
 
 void LCL_vider(LCL_Liste* pliste) {
-  errno = 0;
-  LC_supprimer(&(pliste->liste), pliste->supprimerElement);
+  for (int i = 0; i < pliste->longueur; i++) {
+    pliste->supprimerElement(pliste->elements[i]);
+  }
+  free(pliste->elements);
+  pliste->elements = NULL;
+  pliste->capacite = 0;
   pliste->longueur = 0;
+  errno = 0;
 }
@@ -0,0 +1,197 @@
+/* pthread_rwlock_t (TableHachageConcurrente.h) fait partie des interfaces POSIX, absentes en -std=c11 */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include "TableHachageConcurrente.h"
+
+/* -------------------------------------------------------------------------- */
+/*                 FONCTIONS / VARIABLES PRIVEES AU MODULE                    */
+/* -------------------------------------------------------------------------- */
+
+/* Segment d'une clé : le haché est mélangé une seconde fois pour que le choix du segment
+   ne dépende pas des bits qui choisissent la case dans le segment */
+static THC_Segment* THC_segment(const THC_Dictionnaire* pdico, void* pcle) {
+  const THD_Dictionnaire* pmodele;
+  size_t hache;
+
+  pmodele = &(pdico->segments[0].dico);
+  hache = pmodele->hacher(pcle, pmodele->tailleCle);
+  return &(pdico->segments[(unsigned int)TH_melanger((uint64_t)hache) & (pdico->nbSegments - 1U)]);
+}
+
+
+/* -------------------------------------------------------------------------- */
+/*                    FONCTIONS PUBLIQUES DU MODULE                           */
+/* -------------------------------------------------------------------------- */
+
+THC_Dictionnaire THC_dictionnaire(THD_Dictionnaire modele, unsigned int nbSegments) {
+  THC_Dictionnaire dico;
+  unsigned int n;
+  unsigned int i;
+
+  if (nbSegments == 0U) {
+    nbSegments = THC_NB_SEGMENTS_DEFAUT;
+  }
+  n = 1U;
+  while (n < nbSegments) {
+    n *= 2U;
+  }
+  dico.nbSegments = 0U;
+  dico.segments = (THC_Segment*)aligned_alloc(THC_TAILLE_LIGNE_CACHE, n * sizeof(THC_Segment));
+  if (dico.segments == NULL) {
+    errno = THC_MEMOIRE_ERREUR;
+    return dico;
+  }
+  for (i = 0U; i < n; ++i) {
+    if (pthread_rwlock_init(&(dico.segments[i].verrou), NULL) != 0) {
+      while (i > 0U) {
+        i -= 1U;
+        pthread_rwlock_destroy(&(dico.segments[i].verrou));
+      }
+      free(dico.segments);
+      dico.segments = NULL;
+      errno = THC_MEMOIRE_ERREUR;
+      return dico;
+    }
+    /* chaque segment reprend les fonctions et le mode du modèle, mais a ses propres cases :
+       la place déjà réservée par le modèle n'est pas partagée */
+    dico.segments[i].dico = modele;
+    dico.segments[i].dico.cases = NULL;
+    dico.segments[i].dico.donnees = NULL;
+    dico.segments[i].dico.capacite = 0U;
+    dico.segments[i].dico.nbElements = 0U;
+  }
+  dico.nbSegments = n;
+  errno = 0;
+  return dico;
+}
+
+unsigned int THC_taille(const THC_Dictionnaire* pdico) {
+  unsigned int taille;
+  unsigned int i;
+
+  taille = 0U;
+  for (i = 0U; i < pdico->nbSegments; ++i) {
+    pthread_rwlock_rdlock(&(pdico->segments[i].verrou));
+    taille += THD_taille(pdico->segments[i].dico);
+    pthread_rwlock_unlock(&(pdico->segments[i].verrou));
+  }
+  return taille;
+}
+
+bool THC_contient(const THC_Dictionnaire* pdico, void* pcle) {
+  THC_Segment* psegment;
+  bool present;
+
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_rdlock(&(psegment->verrou));
+  present = THD_contientRef(&(psegment->dico), pcle);
+  pthread_rwlock_unlock(&(psegment->verrou));
+  return present;
+}
+
+void* THC_valeur(const THC_Dictionnaire* pdico, void* pcle) {
+  THC_Segment* psegment;
+  void* pcopie;
+  int erreur;
+
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_rdlock(&(psegment->verrou));
+  pcopie = THD_valeurRef(&(psegment->dico), pcle);
+  erreur = errno;
+  pthread_rwlock_unlock(&(psegment->verrou));
+  errno = (erreur == TH_CLE_ABSENTE_ERREUR) ? THC_CLE_ABSENTE_ERREUR : erreur;
+  return pcopie;
+}
+
+bool THC_lire(const THC_Dictionnaire* pdico, void* pcle, void* pvaleur) {
+  THC_Segment* psegment;
+  const void* pstockee;
+
+  if (pdico->nbSegments == 0U || !pdico->segments[0].dico.enLigne) {
+    errno = THC_MODE_ERREUR;
+    return false;
+  }
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_rdlock(&(psegment->verrou));
+  pstockee = THD_valeurEmprunteeRef(&(psegment->dico), pcle);
+  if (pstockee != NULL) {
+    /* copie faite sous le verrou : la case ne peut pas bouger pendant la lecture */
+    memcpy(pvaleur, pstockee, psegment->dico.tailleValeur);
+  }
+  pthread_rwlock_unlock(&(psegment->verrou));
+  errno = (pstockee != NULL) ? 0 : THC_CLE_ABSENTE_ERREUR;
+  return pstockee != NULL;
+}
+
+void THC_inserer(THC_Dictionnaire* pdico, void* pcle, void* pvaleur) {
+  THC_Segment* psegment;
+  int erreur;
+
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_wrlock(&(psegment->verrou));
+  THD_inserer(&(psegment->dico), pcle, pvaleur);
+  erreur = errno;
+  pthread_rwlock_unlock(&(psegment->verrou));
+  errno = (erreur == TH_MEMOIRE_ERREUR) ? THC_MEMOIRE_ERREUR : erreur;
+}
+
+bool THC_insererSiAbsent(THC_Dictionnaire* pdico, void* pcle, void* pvaleur) {
+  THC_Segment* psegment;
+  bool insere;
+  int erreur;
+
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_wrlock(&(psegment->verrou));
+  insere = false;
+  erreur = 0;
+  /* test et insertion sous le même verrou d'écriture */
+  if (!THD_contientRef(&(psegment->dico), pcle)) {
+    THD_inserer(&(psegment->dico), pcle, pvaleur);
+    erreur = errno;
+    insere = (erreur == 0);
+  }
+  pthread_rwlock_unlock(&(psegment->verrou));
+  errno = (erreur == TH_MEMOIRE_ERREUR) ? THC_MEMOIRE_ERREUR : erreur;
+  return insere;
+}
+
+void THC_supprimer(THC_Dictionnaire* pdico, void* pcle) {
+  THC_Segment* psegment;
+  int erreur;
+
+  psegment = THC_segment(pdico, pcle);
+  pthread_rwlock_wrlock(&(psegment->verrou));
+  THD_supprimer(&(psegment->dico), pcle);
+  erreur = errno;
+  pthread_rwlock_unlock(&(psegment->verrou));
+  errno = (erreur == TH_CLE_ABSENTE_ERREUR) ? THC_CLE_ABSENTE_ERREUR : erreur;
+}
+
+void THC_vider(THC_Dictionnaire* pdico) {
+  unsigned int i;
+
+  for (i = 0U; i < pdico->nbSegments; ++i) {
+    pthread_rwlock_wrlock(&(pdico->segments[i].verrou));
+    THD_vider(&(pdico->segments[i].dico));
+    pthread_rwlock_unlock(&(pdico->segments[i].verrou));
+  }
+  errno = 0;
+}
+
+void THC_supprimerDictionnaire(THC_Dictionnaire* pdico) {
+  unsigned int i;
+
+  for (i = 0U; i < pdico->nbSegments; ++i) {
+    THD_vider(&(pdico->segments[i].dico));
+    pthread_rwlock_destroy(&(pdico->segments[i].verrou));
+  }
+  free(pdico->segments);
+  pdico->segments = NULL;
+  pdico->nbSegments = 0U;
+  errno = 0;
+}
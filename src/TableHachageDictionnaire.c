@@ -8,13 +8,31 @@ THD_Dictionnaire THD_dictionnaire(CLC_FonctionCopier copierCle,
                                 CLC_FonctionComparer comparerCle,
                                 size_t tailleCle,
                                 CLC_FonctionCopier copierValeur,
-                                CLC_FonctionLiberer libererValeur) {
+                                CLC_FonctionLiberer libererValeur,
+                                TH_FonctionHachage hacher) {
   return TH_tableHachage(copierCle,
 			 libererCle,
 			 comparerCle,
 			 tailleCle,
 			 copierValeur,
-			 libererValeur);
+			 libererValeur,
+			 hacher);
+}
+
+THD_Dictionnaire THD_dictionnaireEnLigne(CLC_FonctionCopier copierCle,
+                                        CLC_FonctionLiberer libererCle,
+                                        size_t tailleCle,
+                                        CLC_FonctionCopier copierValeur,
+                                        CLC_FonctionLiberer libererValeur,
+                                        size_t tailleValeur,
+                                        TH_FonctionHachage hacher) {
+  return TH_tableHachageEnLigne(copierCle,
+				libererCle,
+				tailleCle,
+				copierValeur,
+				libererValeur,
+				tailleValeur,
+				hacher);
 }
 
 bool THD_estVide(THD_Dictionnaire dico) {
@@ -29,34 +47,80 @@ bool THD_contient(THD_Dictionnaire dico, void* pcle) {
   return TH_contient(dico, pcle);
 }
 
+bool THD_contientRef(const THD_Dictionnaire* pdico, void* pcle) {
+  return TH_contientRef(pdico, pcle);
+}
+
 void THD_inserer(THD_Dictionnaire* pdico, void* pcle, void* pvaleur) {
   TH_inserer(pdico, pcle, pvaleur);
 }
 
 
+void THD_insererPrendre(THD_Dictionnaire* pdico, void* pcle, void* pvaleur) {
+  TH_insererPrendre(pdico, pcle, pvaleur);
+}
+
 void THD_supprimer(THD_Dictionnaire* pdico, void* pcle) {
   TH_supprimer(pdico, pcle);
 }
 
+void* THD_supprimerPrendre(THD_Dictionnaire* pdico, void* pcle) {
+  return TH_supprimerPrendre(pdico, pcle);
+}
+
 void* THD_valeur(THD_Dictionnaire dico, void* pcle) {
   return TH_valeur(dico, pcle);
 }
 
+void* THD_valeurRef(const THD_Dictionnaire* pdico, void* pcle) {
+  return TH_valeurRef(pdico, pcle);
+}
+
+const void* THD_valeurEmpruntee(THD_Dictionnaire dico, void* pcle) {
+  return TH_valeurEmpruntee(dico, pcle);
+}
+
+const void* THD_valeurEmprunteeRef(const THD_Dictionnaire* pdico, void* pcle) {
+  return TH_valeurEmprunteeRef(pdico, pcle);
+}
+
+void* THD_referenceValeur(THD_Dictionnaire* pdico, void* pcle) {
+  return TH_referenceValeur(pdico, pcle);
+}
+
 LCL_Liste THD_cles(THD_Dictionnaire dico) {
-  void** tableCles = TH_cles(dico);
   LCL_Liste res = LCL_liste(dico.copierCle,
 			    dico.libererCle);
-  unsigned int i;
-  if (tableCles != NULL) {
-    for (i = 0U; i < dico.nbElements; ++i) {
-      LCL_inserer(&res, tableCles[i], 0);
-      dico.libererCle(tableCles[i]);
-    }
-    free(tableCles);
+  THD_Iterateur it = THD_iterateur(&dico);
+  const void* pcle;
+  LCL_reserver(&res, TH_taille(dico));
+  /* la liste copie directement les clés rangées dans le dictionnaire */
+  while (THD_suivant(&it, &pcle, NULL)) {
+    LCL_ajouterFin(&res, (void*)pcle);
   }
   return res;
 }
 
+THD_Iterateur THD_iterateur(const THD_Dictionnaire* pdico) {
+  return TH_iterateur(pdico);
+}
+
+bool THD_suivant(THD_Iterateur* pit, const void** ppcle, const void** ppvaleur) {
+  return TH_suivant(pit, ppcle, ppvaleur);
+}
+
+TH_Statistiques THD_statistiques(const THD_Dictionnaire* pdico) {
+  return TH_statistiques(pdico);
+}
+
+void THD_reserver(THD_Dictionnaire* pdico, unsigned int n) {
+  TH_reserver(pdico, n);
+}
+
+void THD_reinitialiser(THD_Dictionnaire* pdico) {
+  TH_reinitialiser(pdico);
+}
+
 
 void THD_vider(THD_Dictionnaire* pdico) {
   TH_vider(pdico);
@@ -8,17 +8,29 @@
 THE_Ensemble THE_ensemble(CLC_FonctionCopier copier_element,
                         CLC_FonctionLiberer liberer_element,
                         CLC_FonctionComparer comparer_element,
-                        size_t taille_element) {
+                        size_t taille_element,
+                        TH_FonctionHachage hacher) {
   THE_Ensemble ensemble;
 
   /* clé == valeur == élément */
   ensemble = TH_tableHachage(/* clé */
 			     copier_element, liberer_element, comparer_element, taille_element,
 			     /* valeur */
-			     copier_element, liberer_element);
+			     copier_element, liberer_element,
+			     hacher);
   return ensemble;
 }
 
+THE_Ensemble THE_ensembleEnLigne(CLC_FonctionCopier copier_element,
+                                CLC_FonctionLiberer liberer_element,
+                                size_t taille_element,
+                                TH_FonctionHachage hacher) {
+  /* la valeur n'est jamais lue : seule la clé est rangée */
+  return TH_tableHachageEnLigne(copier_element, liberer_element, taille_element,
+				copier_element, liberer_element, 0U,
+				hacher);
+}
+
 bool THE_estVide(THE_Ensemble ensemble) {
   return TH_estVide(ensemble);
 }
@@ -28,20 +40,30 @@ unsigned int THE_cardinalite(THE_Ensemble ensemble) {
 }
 
 LCL_Liste THE_elements(THE_Ensemble ensemble) {
-  void** tableCles = TH_cles(ensemble);
   LCL_Liste res = LCL_liste(ensemble.copierCle,
 			    ensemble.libererCle);
-  unsigned int i;
-  if (tableCles != NULL) {
-    for (i = 0U; i < ensemble.nbElements; ++i) {
-      LCL_inserer(&res, tableCles[i], i+1);
-      ensemble.libererCle(tableCles[i]);
-    }
-    free(tableCles);
+  THE_Iterateur it = THE_iterateur(&ensemble);
+  const void* p_element;
+  LCL_reserver(&res, TH_taille(ensemble));
+  /* la liste copie directement les éléments rangés dans l'ensemble */
+  while (THE_suivant(&it, &p_element)) {
+    LCL_ajouterFin(&res, (void*)p_element);
   }
   return res;
 }
 
+THE_Iterateur THE_iterateur(const THE_Ensemble* pensemble) {
+  return TH_iterateur(pensemble);
+}
+
+bool THE_suivant(THE_Iterateur* pit, const void** ppelement) {
+  return TH_suivant(pit, ppelement, NULL);
+}
+
+TH_Statistiques THE_statistiques(const THE_Ensemble* pensemble) {
+  return TH_statistiques(pensemble);
+}
+
 /* ============================ Modifications ============================= */
 
 void THE_ajouter(THE_Ensemble* pensemble, void* p_element) {
@@ -63,12 +85,28 @@ void THE_vider(THE_Ensemble* pensemble) {
   TH_vider(pensemble);
 }
 
+void THE_reserver(THE_Ensemble* pensemble, unsigned int n) {
+  if (!pensemble) { errno = EINVAL; return; }
+
+  TH_reserver(pensemble, n);
+}
+
+void THE_reinitialiser(THE_Ensemble* pensemble) {
+  if (!pensemble) { errno = EINVAL; return; }
+
+  TH_reinitialiser(pensemble);
+}
+
 /* ============================== Requêtes ================================ */
 
 bool THE_estPresent(THE_Ensemble ensemble, void* p_element) {
   return TH_contient(ensemble, p_element);
 }
 
+bool THE_estPresentRef(const THE_Ensemble* pensemble, void* p_element) {
+  return TH_contientRef(pensemble, p_element);
+}
+
 /* ======================= Opérations ensemblistes ======================== */
 
 /*
@@ -79,10 +117,18 @@ bool THE_estPresent(THE_Ensemble ensemble, void* p_element) {
 static THE_Ensemble THE_creerComme(THE_Ensemble a) {
   THE_Ensemble nouvel_ensemble;
 
-  nouvel_ensemble = THE_ensemble(a.copierCle,
-                                a.libererCle,
-                                a.comparerCle,
-                                a.tailleCle);
+  if (a.enLigne) {
+    nouvel_ensemble = THE_ensembleEnLigne(a.copierCle,
+                                         a.libererCle,
+                                         a.tailleCle,
+                                         a.hacher);
+  } else {
+    nouvel_ensemble = THE_ensemble(a.copierCle,
+                                  a.libererCle,
+                                  a.comparerCle,
+                                  a.tailleCle,
+                                  a.hacher);
+  }
   return nouvel_ensemble;
 }
 
@@ -98,19 +144,16 @@ static void THE_ajouter_selon(THE_Ensemble* p_resultat,
                              THE_Ensemble ensemble_source,
                              THE_Ensemble ensemble_autre,
                              THE_FonctionTestElement fonction_test) {
-  void** cles;
-  unsigned int i;
-  void* p_element;
-
-  cles = TH_cles(ensemble_source);
-  for (i = 0; i < THE_cardinalite(ensemble_source); ++i) {
-    p_element = cles[i];
-    if (fonction_test(ensemble_source, ensemble_autre, p_element)) {
-      THE_ajouter(p_resultat, p_element);
+  THE_Iterateur it;
+  const void* p_element;
+
+  /* parcours direct des cases de la source : seul l'ajout au résultat copie l'élément */
+  it = THE_iterateur(&ensemble_source);
+  while (THE_suivant(&it, &p_element)) {
+    if (fonction_test(ensemble_source, ensemble_autre, (void*)p_element)) {
+      THE_ajouter(p_resultat, (void*)p_element);
     }
-    ensemble_source.libererCle(cles[i]);
   }
-  free(cles);
 }
 
 /* Prédicats concrets (privés) */
@@ -128,7 +171,7 @@ static bool THE_test_present_dans_autre(THE_Ensemble ensemble_source,
                                        void* p_element) {
   bool ok;
   (void)ensemble_source;
-  ok = THE_estPresent(ensemble_autre, p_element);
+  ok = THE_estPresentRef(&ensemble_autre, p_element);
   return ok;
 }
 
@@ -137,7 +180,7 @@ static bool THE_test_absent_de_autre(THE_Ensemble ensemble_source,
                                     void* p_element) {
   bool ok;
   (void)ensemble_source;
-  ok = !THE_estPresent(ensemble_autre, p_element);
+  ok = !THE_estPresentRef(&ensemble_autre, p_element);
   return ok;
 }
 
@@ -0,0 +1,227 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <pthread.h>
+#include "allocateurBlocs.h"
+
+#ifdef AB_DESACTIVER
+
+void* AB_allouer(size_t taille) {
+  return malloc(taille);
+}
+
+void AB_liberer(void* p, size_t taille) {
+  (void)taille;
+  free(p);
+}
+
+#else
+
+/* -------------------------------------------------------------------------- */
+/*                 FONCTIONS / VARIABLES PRIVEES AU MODULE                    */
+/* -------------------------------------------------------------------------- */
+
+#define AB_TAILLE_ENTETE 16 /* en-tête d'une plaque : chaînage des plaques, puis blocs alignés sur 16 */
+
+typedef struct AB_BlocLibre {
+  struct AB_BlocLibre* suivant;
+} AB_BlocLibre;
+
+typedef struct {
+  AB_BlocLibre*  libres;   /* blocs rendus, réutilisés en premier */
+  unsigned int   nbLibres; /* longueur de libres */
+  unsigned char* courant;  /* prochain bloc jamais servi de la plaque courante */
+  unsigned char* fin;      /* fin de la plaque courante */
+} AB_Classe;
+
+static _Thread_local AB_Classe AB_classes[AB_NB_CLASSES];
+static _Thread_local bool AB_threadEnregistre = false;
+
+/* Toutes les plaques, chaînées par leur en-tête : elles restent atteignables jusqu'à la fin du programme */
+static void* AB_plaques = NULL;
+/* Blocs libres partagés par tous les threads, une liste par classe */
+static AB_BlocLibre* AB_depot[AB_NB_CLASSES];
+/* Protège AB_plaques et AB_depot */
+static pthread_mutex_t AB_verrou = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_key_t AB_cleThread;
+static pthread_once_t AB_cleCreee = PTHREAD_ONCE_INIT;
+
+/* Classe d'une taille de 1 à AB_TAILLE_MAX : 0 pour 8 octets, 1 pour 16, 2 pour 32, 3 pour 64 */
+static unsigned int AB_classe(size_t taille) {
+  unsigned int classe;
+  size_t tailleBloc;
+
+  classe = 0U;
+  tailleBloc = 8U;
+  while (tailleBloc < taille) {
+    tailleBloc *= 2U;
+    classe += 1U;
+  }
+  return classe;
+}
+
+/* Détache au plus nb blocs de la tête de *pliste et les range dans le dépôt de la classe
+   (sous le verrou) ; renvoie le nombre de blocs déplacés */
+static unsigned int AB_deposer(AB_BlocLibre** pliste, unsigned int nb, unsigned int classe) {
+  AB_BlocLibre* premier;
+  AB_BlocLibre* dernier;
+  unsigned int n;
+
+  if (*pliste == NULL || nb == 0U) {
+    return 0U;
+  }
+  premier = *pliste;
+  dernier = premier;
+  n = 1U;
+  while (n < nb && dernier->suivant != NULL) {
+    dernier = dernier->suivant;
+    n += 1U;
+  }
+  *pliste = dernier->suivant;
+  pthread_mutex_lock(&AB_verrou);
+  dernier->suivant = AB_depot[classe];
+  AB_depot[classe] = premier;
+  pthread_mutex_unlock(&AB_verrou);
+  return n;
+}
+
+/* Destructeur appelé à la fin de chaque thread qui a alloué : ses blocs libres et la partie jamais
+   servie de ses plaques courantes rejoignent le dépôt, où les autres threads les reprendront */
+static void AB_rendreClasses(void* pclasses) {
+  AB_Classe* pclasse;
+  AB_BlocLibre* pbloc;
+  size_t tailleBloc;
+  unsigned int classe;
+
+  (void)pclasses;
+  for (classe = 0U; classe < AB_NB_CLASSES; ++classe) {
+    pclasse = &AB_classes[classe];
+    tailleBloc = (size_t)8U << classe;
+    while ((size_t)(pclasse->fin - pclasse->courant) >= tailleBloc) {
+      pbloc = (AB_BlocLibre*)pclasse->courant;
+      pbloc->suivant = pclasse->libres;
+      pclasse->libres = pbloc;
+      pclasse->courant += tailleBloc;
+    }
+    AB_deposer(&pclasse->libres, UINT_MAX, classe);
+    pclasse->nbLibres = 0U;
+  }
+  /* un destructeur appelé ensuite qui allouerait encore réinscrit le thread */
+  AB_threadEnregistre = false;
+}
+
+static void AB_creerCle(void) {
+  pthread_key_create(&AB_cleThread, AB_rendreClasses);
+}
+
+/* Inscrit le thread courant, à son premier appel au module (allocation ou libération), pour que
+   AB_rendreClasses soit appelé à sa fin */
+static void AB_enregistrerThread(void) {
+  if (AB_threadEnregistre) {
+    return;
+  }
+  pthread_once(&AB_cleCreee, AB_creerCle);
+  /* seule une valeur non NULL déclenche le destructeur */
+  pthread_setspecific(AB_cleThread, AB_classes);
+  AB_threadEnregistre = true;
+}
+
+/* Réapprovisionne une classe épuisée : d'abord au plus AB_TAILLE_LOT blocs du dépôt,
+   à défaut une plaque neuve obtenue par malloc */
+static bool AB_nouvellePlaque(AB_Classe* pclasse, unsigned int classe) {
+  unsigned char* plaque;
+  AB_BlocLibre* dernier;
+  unsigned int n;
+
+  pthread_mutex_lock(&AB_verrou);
+  if (AB_depot[classe] != NULL) {
+    dernier = AB_depot[classe];
+    n = 1U;
+    while (n < AB_TAILLE_LOT && dernier->suivant != NULL) {
+      dernier = dernier->suivant;
+      n += 1U;
+    }
+    pclasse->libres = AB_depot[classe];
+    pclasse->nbLibres = n;
+    AB_depot[classe] = dernier->suivant;
+    dernier->suivant = NULL;
+    pthread_mutex_unlock(&AB_verrou);
+    return true;
+  }
+  pthread_mutex_unlock(&AB_verrou);
+
+  plaque = (unsigned char*)malloc(AB_TAILLE_PLAQUE);
+  if (plaque == NULL) {
+    return false;
+  }
+  pthread_mutex_lock(&AB_verrou);
+  *(void**)plaque = AB_plaques;
+  AB_plaques = plaque;
+  pthread_mutex_unlock(&AB_verrou);
+  pclasse->courant = plaque + AB_TAILLE_ENTETE;
+  pclasse->fin = plaque + AB_TAILLE_PLAQUE;
+  return true;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/*                    FONCTIONS PUBLIQUES DU MODULE                           */
+/* -------------------------------------------------------------------------- */
+
+void* AB_allouer(size_t taille) {
+  AB_Classe* pclasse;
+  AB_BlocLibre* pbloc;
+  size_t tailleBloc;
+  unsigned int classe;
+
+  if (taille > AB_TAILLE_MAX) {
+    return malloc(taille);
+  }
+  classe = AB_classe(taille);
+  pclasse = &AB_classes[classe];
+  tailleBloc = (size_t)8U << classe;
+  if (pclasse->libres == NULL && (size_t)(pclasse->fin - pclasse->courant) < tailleBloc) {
+    AB_enregistrerThread();
+    if (!AB_nouvellePlaque(pclasse, classe)) {
+      return NULL;
+    }
+  }
+  if (pclasse->libres != NULL) {
+    pbloc = pclasse->libres;
+    pclasse->libres = pbloc->suivant;
+    pclasse->nbLibres -= 1U;
+    return pbloc;
+  }
+  pbloc = (AB_BlocLibre*)pclasse->courant;
+  pclasse->courant += tailleBloc;
+  return pbloc;
+}
+
+void AB_liberer(void* p, size_t taille) {
+  AB_Classe* pclasse;
+  AB_BlocLibre* pbloc;
+  unsigned int classe;
+
+  if (p == NULL) {
+    return;
+  }
+  if (taille > AB_TAILLE_MAX) {
+    free(p);
+    return;
+  }
+  /* un thread qui ne fait que libérer (consommateur) doit aussi rendre ses blocs à sa fin */
+  AB_enregistrerThread();
+  classe = AB_classe(taille);
+  pclasse = &AB_classes[classe];
+  pbloc = (AB_BlocLibre*)p;
+  pbloc->suivant = pclasse->libres;
+  pclasse->libres = pbloc;
+  pclasse->nbLibres += 1U;
+  if (pclasse->nbLibres > 2U * AB_TAILLE_LOT) {
+    /* un thread qui libère plus qu'il n'alloue (consommateur) rend un lot aux autres threads */
+    pclasse->nbLibres -= AB_deposer(&pclasse->libres, AB_TAILLE_LOT, classe);
+  }
+}
+
+#endif
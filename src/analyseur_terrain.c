@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
 
 /**
  * \brief Convertit un caractère de direction en énumération DI_Direction
@@ -26,6 +27,16 @@ static DI_Direction AT_charVersDirection(char c) {
     }
 }
 
+/**
+ * \brief Vérifie qu'un numéro de case (à partir de 1) désigne une case du terrain
+ * \param numero Le numéro lu
+ * \param largeur La largeur du terrain
+ * \return 1 si la case existe, 0 sinon
+ */
+static int AT_numeroCaseValide(unsigned int numero, unsigned int largeur) {
+    return numero > 0 && numero <= largeur * largeur;
+}
+
 /**
  * \brief Ignore les espaces et tabulations dans le flux
  * \param flux Le flux à traiter
@@ -67,6 +78,44 @@ static int AT_lireCaractere(FILE* flux, char* c) {
     return 1;
 }
 
+/**
+ * \brief Lot de passages lus, ajoutés au terrain en une fois à la fin du flux
+ */
+typedef struct {
+    CO_Coordonnee* extremitesA;
+    CO_Coordonnee* extremitesB;
+    unsigned int nb;
+    unsigned int capacite;
+} AT_LotPassages;
+
+/**
+ * \brief Ajoute un passage au lot (le lot double de taille quand il est plein)
+ * \param lot Pointeur vers le lot
+ * \param a Première extrémité
+ * \param b Seconde extrémité
+ * \return 1 si succès, 0 si plus de mémoire
+ */
+static int AT_ajouterPassage(AT_LotPassages* lot, CO_Coordonnee a, CO_Coordonnee b) {
+    if (lot->nb == lot->capacite) {
+        unsigned int capacite = (lot->capacite == 0) ? 64 : 2 * lot->capacite;
+        CO_Coordonnee* extremitesA = realloc(lot->extremitesA, capacite * sizeof(CO_Coordonnee));
+        if (extremitesA == NULL) {
+            return 0;
+        }
+        lot->extremitesA = extremitesA;
+        CO_Coordonnee* extremitesB = realloc(lot->extremitesB, capacite * sizeof(CO_Coordonnee));
+        if (extremitesB == NULL) {
+            return 0;
+        }
+        lot->extremitesB = extremitesB;
+        lot->capacite = capacite;
+    }
+    lot->extremitesA[lot->nb] = a;
+    lot->extremitesB[lot->nb] = b;
+    lot->nb++;
+    return 1;
+}
+
 /**
  * \brief Lit une ligne complète et vérifie si c'est la fin (point)
  * \param flux Le flux d'entrée
@@ -145,6 +194,8 @@ T_Terrain AT_analyseurTerrain(FILE* flux) {
     terrain.directionDepart = dirDepart;
     
     // 3. Lexcture des chemin et des objectifs 
+    // Les passages sont collectés puis ajoutés d'un seul coup à la fin (tri et dédoublonnage, voir T_ajouterChemins)
+    AT_LotPassages passages = {NULL, NULL, 0, 0};
     while (AT_lireLigne(flux, buffer, sizeof(buffer))) {
         // Ignorer les lignes vides
         char* ptr = buffer;
@@ -160,19 +211,45 @@ T_Terrain AT_analyseurTerrain(FILE* flux) {
             // C'est un passage : case1-case2
             unsigned int case1, case2;
             if (sscanf(buffer, "%u-%u", &case1, &case2) == 2) {
+                // Une ligne invalide est ignorée seule, sans empêcher l'ajout des autres passages
+                if (!AT_numeroCaseValide(case1, largeur) || !AT_numeroCaseValide(case2, largeur)) {
+                    printf("ERREUR : passage %u-%u hors du terrain, ignoré\n", case1, case2);
+                    continue;
+                }
                 CO_Coordonnee coord1 = CO_NumeroCaseVersCoordonnee(case1, largeur);
                 CO_Coordonnee coord2 = CO_NumeroCaseVersCoordonnee(case2, largeur);
-                T_ajouterChemin(&terrain, coord1, coord2);
+                if (!AT_ajouterPassage(&passages, coord1, coord2)) {
+                    printf("ERREUR : mémoire insuffisante pour les passages");
+                    free(passages.extremitesA);
+                    free(passages.extremitesB);
+                    T_supprimerTerrain(&terrain);
+                    return T_terrain(0);
+                }
             }
         } else {
             // C'est un objectif  
             unsigned int caseObjectif;
             if (sscanf(buffer, "%u", &caseObjectif) == 1) {
+                if (!AT_numeroCaseValide(caseObjectif, largeur)) {
+                    printf("ERREUR : objectif %u hors du terrain, ignoré\n", caseObjectif);
+                    continue;
+                }
                 CO_Coordonnee coordObjectif = CO_NumeroCaseVersCoordonnee(caseObjectif, largeur);
                 T_ajouterObjectif(&terrain, coordObjectif);
             }
         }
     }
+    unsigned int nbIgnores = T_ajouterChemins(&terrain, passages.extremitesA, passages.extremitesB, passages.nb);
+    free(passages.extremitesA);
+    free(passages.extremitesB);
+    if (errno == G_MEMOIRE_ERREUR) {
+        printf("ERREUR : mémoire insuffisante pour les passages");
+        T_supprimerTerrain(&terrain);
+        return T_terrain(0);
+    }
+    if (nbIgnores > 0) {
+        printf("ERREUR : %u passage(s) invalide(s) ignoré(s)\n", nbIgnores);
+    }
 
     return terrain;
 }
@@ -4,28 +4,25 @@
 
 CH_Chemin CH_chemin(){
     CH_Chemin ch;
-    ch.etapes = LCF_file(NULL, NULL);
-    ch.longueur = 0;
+    ch.etapes = FC_file(sizeof(CO_Coordonnee));
     return ch;
 }
 
 void CH_enfilerEtape(CH_Chemin* ch, CO_Coordonnee* etape){
-    LCF_enfiler(&ch->etapes, etape);
-    ch->longueur = ch->longueur + 1;
+    FC_enfiler(&ch->etapes, etape);
 }
 
 CO_Coordonnee CH_defilerEtape(CH_Chemin* ch){
-    assert(ch->longueur > 0);
+    assert(FC_longueur(ch->etapes) > 0);
     CO_Coordonnee c;
-    c = *(CO_Coordonnee*)LCF_defiler(&ch->etapes);
-    ch->longueur = ch->longueur - 1;
+    FC_defiler(&ch->etapes, &c);
     return c;
 }
 
 unsigned int CH_longueurChemin(CH_Chemin ch){
-    return ch.longueur;
+    return FC_longueur(ch.etapes);
 }
 
 void CH_supprimerChemin(CH_Chemin* ch){
-    LCF_vider(&ch->etapes);
-}
\ No newline at end of file
+    FC_vider(&ch->etapes);
+}
@@ -1,4 +1,6 @@
 #include "coordonnee.h"
+#include "tableHachage.h"
+#include "allocateurBlocs.h"
 #include <errno.h>
 #include <assert.h>
 #include <stdlib.h>
@@ -51,17 +53,26 @@ bool CO_sontEgales(CO_Coordonnee coord1, CO_Coordonnee coord2){
 
 void* CO_copier(void* pcoord){
     CO_Coordonnee* pnewcoord;
-	pnewcoord = (CO_Coordonnee*) malloc(sizeof(CO_Coordonnee));
+	pnewcoord = (CO_Coordonnee*) AB_allouer(sizeof(CO_Coordonnee));
+	if (pnewcoord == NULL) {
+		return NULL;
+	}
 	pnewcoord->x = CO_abscisse(*(CO_Coordonnee*)pcoord);
 	pnewcoord->y = CO_ordonnee(*(CO_Coordonnee*)pcoord);
 	return pnewcoord;
 }
 
 void CO_liberer(void* pcoord){
-    free(pcoord);
+    AB_liberer(pcoord, sizeof(CO_Coordonnee));
 }
 
 
 int CO_comparer(void* pcoord1,void* pcoord2){
 	return CO_sontEgales(*(CO_Coordonnee*)pcoord1, *(CO_Coordonnee*)pcoord2) ? 0 : 1;
-}
\ No newline at end of file
+}
+
+size_t CO_hacher(void* pcoord, size_t taille){
+	CO_Coordonnee c = *(CO_Coordonnee*)pcoord;
+	(void)taille;
+	return (size_t)TH_melanger(((uint64_t)(unsigned int)c.y << 32) | (uint64_t)(unsigned int)c.x);
+}
@@ -2,6 +2,17 @@
 #include <stdlib.h>
 #include <string.h>
 #include "copieLiberationComparaisonTypesSimples.h"
+#include "allocateurBlocs.h"
+
+/* Copie d'un type simple dans un petit bloc (voir allocateurBlocs.h) */
+static void* CLCTS_copierBloc(void* p, size_t taille) {
+    void* copie = AB_allouer(taille);
+    if (copie == NULL) {
+	return NULL;
+    }
+    memcpy(copie, p, taille);
+    return copie;
+}
 
 void* CLCTS_copierGenerique(void* p, size_t taille) {
     void* copie = malloc(taille);
@@ -17,11 +28,11 @@ void CLCTS_libererGenerique(void* p) {
 }
 
 void* CLCTS_copierChar(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(char));
+    return CLCTS_copierBloc(p, sizeof(char));
 }
 
 void CLCTS_libererChar(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(char));
 }
 
 int CLCTS_comparerChar(void* p1, void* p2) {
@@ -41,11 +52,11 @@ int CLCTS_comparerUnsignedChar(void* p1, void* p2) {
 }
 
 void* CLCTS_copierInt(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(int));
+    return CLCTS_copierBloc(p, sizeof(int));
 }
 
 void CLCTS_libererInt(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(int));
 }
 
 int CLCTS_comparerInt(void* p1, void* p2) {
@@ -65,11 +76,11 @@ int CLCTS_comparerUnsignedInt(void* p1, void* p2) {
 }
 
 void* CLCTS_copierLong(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(long));
+    return CLCTS_copierBloc(p, sizeof(long));
 }
 
 void CLCTS_libererLong(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(long));
 }
 
 int CLCTS_comparerLong(void* p1, void* p2) {
@@ -89,11 +100,11 @@ int CLCTS_comparerUnsignedLong(void* p1, void* p2) {
 }
 
 void* CLCTS_copierLongLong(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(long long));
+    return CLCTS_copierBloc(p, sizeof(long long));
 }
 
 void CLCTS_libererLongLong(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(long long));
 }
 
 int CLCTS_comparerLongLong(void* p1, void* p2) {
@@ -113,11 +124,11 @@ int CLCTS_comparerUnsignedLongLong(void* p1, void* p2) {
 }
 
 void* CLCTS_copierFloat(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(float));
+    return CLCTS_copierBloc(p, sizeof(float));
 }
 
 void CLCTS_libererFloat(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(float));
 }
 
 int CLCTS_comparerFloat(void* p1, void* p2) {
@@ -129,11 +140,11 @@ int CLCTS_comparerFloat(void* p1, void* p2) {
 }
 
 void* CLCTS_copierDouble(void* p) {
-    return CLCTS_copierGenerique(p, sizeof(double));
+    return CLCTS_copierBloc(p, sizeof(double));
 }
 
 void CLCTS_libererDouble(void* p) {
-    CLCTS_libererGenerique(p);
+    AB_liberer(p, sizeof(double));
 }
 
 int CLCTS_comparerDouble(void* p1, void* p2) {
@@ -1,12 +1,19 @@
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "graphe.h"
 #include "copieLiberationComparaisonTypesSimples.h"
+#include "allocateurBlocs.h"
 
 void* G_copierArc(void* parc) {
   if (parc == NULL) {
     errno = G_SOMMET_ERREUR;
     return NULL;
   }
-  G_Arc* copie = malloc(sizeof(G_Arc));
+  G_Arc* copie = AB_allouer(sizeof(G_Arc));
   if (copie == NULL) {
     errno = G_MEMOIRE_ERREUR;
     return NULL;
@@ -18,9 +25,7 @@ void* G_copierArc(void* parc) {
 }
 
 void G_libererArc(void* parc) {
-  if (parc != NULL) {
-    free(parc);
-  }
+  AB_liberer(parc, sizeof(G_Arc));
 }
 
 int G_comparerArcs(void* parc1, void* parc2) {
@@ -34,6 +39,128 @@ int G_comparerArcs(void* parc1, void* parc2) {
   return (arc1.src == arc2.src && arc1.dest == arc2.dest) ? 0 : 1;
 }
 
+size_t G_hacherArc(void* parc, size_t taille) {
+  G_Arc arc = *((G_Arc*)parc);
+  (void)taille;
+  return (size_t)TH_melanger(((uint64_t)arc.src << 32) | (uint64_t)arc.dest);
+}
+
+// Change la capacité du tableau (et de ses poids si pondere est vrai)
+static bool G_tableauIdsRedimensionner(G_TableauIds *pt, unsigned int capacite, bool pondere) {
+  unsigned int *ids = realloc(pt->ids, capacite * sizeof(unsigned int));
+  if (ids == NULL) {
+    return false;
+  }
+  pt->ids = ids;
+  if (pondere) {
+    float *poids = realloc(pt->poids, capacite * sizeof(float));
+    if (poids == NULL) {
+      return false; // la capacité n'est pas modifiée, le tableau ids plus grand reste utilisable
+    }
+    pt->poids = poids;
+  }
+  pt->capacite = capacite;
+  return true;
+}
+
+// Garantit la place pour supplement ids de plus, sans réallocation ultérieure
+static bool G_tableauIdsReserver(G_TableauIds *pt, unsigned int supplement, bool pondere) {
+  if (pt->nb + supplement <= pt->capacite) {
+    return true;
+  }
+  return G_tableauIdsRedimensionner(pt, pt->nb + supplement, pondere);
+}
+
+static bool G_tableauIdsAjouter(G_TableauIds *pt, unsigned int id, bool pondere, float poids) {
+  if (pt->nb == pt->capacite &&
+      !G_tableauIdsRedimensionner(pt, (pt->capacite == 0) ? 4 : 2 * pt->capacite, pondere)) {
+    return false;
+  }
+  if (pondere) {
+    pt->poids[pt->nb] = poids;
+  }
+  pt->ids[pt->nb++] = id;
+  return true;
+}
+
+// Retire toutes les occurrences de id en conservant l'ordre des autres (et leurs poids), retourne le nombre d'occurrences retirées
+static unsigned int G_tableauIdsRetirer(G_TableauIds *pt, unsigned int id) {
+  unsigned int ecriture = 0;
+  for (unsigned int i = 0; i < pt->nb; i++) {
+    if (pt->ids[i] != id) {
+      if (pt->poids != NULL) {
+        pt->poids[ecriture] = pt->poids[i];
+      }
+      pt->ids[ecriture++] = pt->ids[i];
+    }
+  }
+  unsigned int nbRetires = pt->nb - ecriture;
+  pt->nb = ecriture;
+  return nbRetires;
+}
+
+// Position de la première occurrence de id, ou t.nb si id est absent
+static unsigned int G_tableauIdsPosition(G_TableauIds t, unsigned int id) {
+  unsigned int i = 0;
+  while (i < t.nb && t.ids[i] != id) {
+    i++;
+  }
+  return i;
+}
+
+static void G_tableauIdsLiberer(G_TableauIds *pt) {
+  free(pt->ids);
+  free(pt->poids);
+  pt->ids = NULL;
+  pt->poids = NULL;
+  pt->nb = 0;
+  pt->capacite = 0;
+}
+
+// Agrandit le tableau des adjacences pour que id y soit indexable
+static bool G_reserverAdjacence(G_Graphe *pg, unsigned int id) {
+  if (id < pg->nbAdjacences) {
+    return true;
+  }
+  unsigned int nb = 2 * pg->nbAdjacences;
+  if (nb <= id) {
+    nb = id + 1;
+  }
+  G_Adjacence *adjacences = realloc(pg->adjacences, nb * sizeof(G_Adjacence));
+  if (adjacences == NULL) {
+    return false;
+  }
+  for (unsigned int i = pg->nbAdjacences; i < nb; i++) {
+    adjacences[i].sortants = (G_TableauIds){NULL, 0, 0, NULL};
+    adjacences[i].entrants = (G_TableauIds){NULL, 0, 0, NULL};
+  }
+  pg->adjacences = adjacences;
+  pg->nbAdjacences = nb;
+  return true;
+}
+
+static const G_TableauIds G_AUCUN_ID = {NULL, 0, 0, NULL};
+
+static G_TableauIds G_sortants(const G_Graphe *pg, unsigned int id) {
+  return (id < pg->nbAdjacences) ? pg->adjacences[id].sortants : G_AUCUN_ID;
+}
+
+static bool G_estPresentDansBitmap(const unsigned char *bitmap, unsigned int id) {
+  return (bitmap[id / 8] >> (id % 8)) & 1U;
+}
+
+static bool G_estPresent(const G_Graphe *pg, unsigned int id) {
+  if (pg->dense) {
+    return id < pg->nbIdsDense && G_estPresentDansBitmap(pg->presence, id);
+  }
+  for (unsigned int i = 0; i < (unsigned int)LCL_longueur(pg->sommets); i++) {
+    if (*(const int*)LCL_elementEmprunte(&pg->sommets, i) == (int)id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 G_Graphe G_graphe(bool oriente,
 		  void* (*copierEtiquette) (void*),
 		  void (*libererEtiquette) (void*),
@@ -43,17 +170,31 @@ G_Graphe G_graphe(bool oriente,
 		  int (*comparerValeurs) (void*, void*)) {
   G_Graphe g;
   g.oriente = oriente;
+  g.pondere = false;
   g.sommets = LCL_liste(CLCTS_copierInt, CLCTS_libererInt);
   g.arcs = LCL_liste(G_copierArc, G_libererArc);
+  g.indexArcs = THD_dictionnaireEnLigne(G_copierArc, G_libererArc, sizeof(G_Arc),
+				       CLCTS_copierInt, CLCTS_libererInt, sizeof(unsigned int), G_hacherArc);
+  g.nbArcsEnDouble = 0;
+  g.nbArcsRejetes = 0;
+  g.adjacences = NULL;
+  g.nbAdjacences = 0;
+  g.dense = false;
+  g.nbIdsDense = 0;
+  g.presence = NULL;
+  g.nbSommets = 0;
+  g.etiquettesDenses = NULL;
   g.etiquettes = THD_dictionnaire(CLCTS_copierInt, CLCTS_libererInt, CLCTS_comparerInt,
 				  sizeof(int),
-				  copierEtiquette, libererEtiquette);
+				  copierEtiquette, libererEtiquette,
+				  TH_hacherEntier);
   g.copierEtiquette = copierEtiquette;
   g.libererEtiquette = libererEtiquette;
   g.comparerEtiquettes = comparerEtiquettes;
   g.valeurs = THD_dictionnaire(G_copierArc, G_libererArc, G_comparerArcs,
 			      sizeof(G_Arc),
-			      copierValeur, libererValeur);
+			      copierValeur, libererValeur,
+			      G_hacherArc);
   g.copierValeur = copierValeur;
   g.libererValeur = libererValeur;
   g.comparerValeurs = comparerValeurs;
@@ -70,164 +211,592 @@ G_Graphe G_graphe(bool oriente,
   return g;
 }
 
+G_Graphe G_grapheDense(bool oriente,
+		       unsigned int nbIds,
+		       void* (*copierEtiquette) (void*),
+		       void (*libererEtiquette) (void*),
+		       int (*comparerEtiquettes) (void*, void*),
+		       void* (*copierValeur) (void*),
+		       void (*libererValeur) (void*),
+		       int (*comparerValeurs) (void*, void*)) {
+  G_Graphe g = G_graphe(oriente, copierEtiquette, libererEtiquette, comparerEtiquettes,
+			copierValeur, libererValeur, comparerValeurs);
+  int erreur = errno;
+  g.dense = true;
+  if (nbIds == 0) {
+    return g;
+  }
+  g.presence = calloc(((size_t)nbIds + 7) / 8, sizeof(unsigned char));
+  g.adjacences = calloc(nbIds, sizeof(G_Adjacence));
+  if (copierEtiquette != NULL) {
+    g.etiquettesDenses = calloc(nbIds, sizeof(void*));
+  }
+  if (g.presence == NULL || g.adjacences == NULL || (copierEtiquette != NULL && g.etiquettesDenses == NULL)) {
+    free(g.presence);
+    free(g.adjacences);
+    free(g.etiquettesDenses);
+    g.presence = NULL;
+    g.adjacences = NULL;
+    g.etiquettesDenses = NULL;
+    errno = G_MEMOIRE_ERREUR;
+    return g;
+  }
+  g.nbIdsDense = nbIds;
+  g.nbAdjacences = nbIds;
+  errno = erreur;
+  return g;
+}
+
+static int G_ajouterSommetDense(G_Graphe *pg, unsigned int id, void *petiquette) {
+  if (id >= pg->nbIdsDense || G_estPresentDansBitmap(pg->presence, id)) {
+    errno = G_SOMMET_ERREUR;
+    return -1;
+  }
+  if (petiquette != NULL) {
+    pg->etiquettesDenses[id] = pg->copierEtiquette(petiquette);
+    if (pg->etiquettesDenses[id] == NULL) {
+      errno = G_MEMOIRE_ERREUR;
+      return -1;
+    }
+  }
+  pg->presence[id / 8] |= (unsigned char)(1U << (id % 8));
+  pg->nbSommets++;
+  errno = 0;
+  return id;
+}
+
 int G_ajouterSommet(G_Graphe *pg, unsigned int id, void *petiquette) {
   if (petiquette != NULL && pg->copierEtiquette == NULL) {
     errno = G_GRAPHE_NON_ETIQUETE_ERREUR;
     return -1;
   }
-  if (G_sommetPresent(*pg, id)) {
+  if (pg->dense) {
+    return G_ajouterSommetDense(pg, id, petiquette);
+  }
+  if (G_estPresent(pg, id)) {
     errno = G_SOMMET_ERREUR;
     return -1;
   }
   errno = 0;
-  LCL_inserer(&pg->sommets, &id, LCL_longueur(pg->sommets));
+  LCL_ajouterFin(&pg->sommets, &id);
   if (petiquette != NULL) {
     THD_inserer(&pg->etiquettes, &id, petiquette);
   }
   return id;
 }
 
-int G_ajouterArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *pvaleur) {
+// Forme sous laquelle l'arc est rangé dans l'index : (min,max) pour un graphe non orienté
+static G_Arc G_arcCanonique(bool oriente, unsigned int idSrc, unsigned int idDest) {
+  G_Arc arc;
+  arc.src = (!oriente && idDest < idSrc) ? idDest : idSrc;
+  arc.dest = (!oriente && idDest < idSrc) ? idSrc : idDest;
+  return arc;
+}
+
+static int G_ajouterArcPoids(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *pvaleur, float poids) {
   if (pvaleur != NULL && pg->copierValeur == NULL) {
     errno = G_GRAPHE_NON_VALUE_ERREUR;
     return -1;
   }
+  if (pg->dense && (idSrc >= pg->nbIdsDense || idDest >= pg->nbIdsDense)) {
+    pg->nbArcsRejetes++;
+    errno = G_SOMMET_ERREUR;
+    return -1;
+  }
+  G_Arc arcCanonique = G_arcCanonique(pg->oriente, idSrc, idDest);
+  if (THD_contientRef(&pg->indexArcs, &arcCanonique)) {
+    pg->nbArcsEnDouble++;
+    errno = G_ARC_DEJA_PRESENT_ERREUR;
+    return -1;
+  }
+  if (!G_reserverAdjacence(pg, (idSrc > idDest) ? idSrc : idDest)) {
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
+  bool ok = G_tableauIdsAjouter(&pg->adjacences[idSrc].sortants, idDest, pg->pondere, poids);
+  if (ok && pg->oriente) {
+    ok = G_tableauIdsAjouter(&pg->adjacences[idDest].entrants, idSrc, false, 0.0f);
+    if (!ok) pg->adjacences[idSrc].sortants.nb--;
+  } else if (ok && idSrc != idDest) {
+    ok = G_tableauIdsAjouter(&pg->adjacences[idDest].sortants, idSrc, pg->pondere, poids);
+    if (!ok) pg->adjacences[idSrc].sortants.nb--;
+  }
+  if (ok) {
+    unsigned int position = (unsigned int)LCL_longueur(pg->arcs);
+    THD_inserer(&pg->indexArcs, &arcCanonique, &position);
+    ok = (errno == 0);
+    if (!ok) {
+      G_tableauIdsRetirer(&pg->adjacences[idSrc].sortants, idDest);
+      G_tableauIdsRetirer(pg->oriente ? &pg->adjacences[idDest].entrants : &pg->adjacences[idDest].sortants, idSrc);
+    }
+  }
+  if (!ok) {
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
   G_Arc arc;
   arc.src = idSrc;
   arc.dest = idDest;
-  LCL_inserer(&pg->arcs, &arc, LCL_longueur(pg->arcs));
+  // L'index désigne déjà la fin de la liste : il ne doit pas survivre à un ajout manqué
+  LCL_ajouterFin(&pg->arcs, &arc);
+  if (errno != 0) {
+    THD_supprimer(&pg->indexArcs, &arcCanonique);
+    G_tableauIdsRetirer(&pg->adjacences[idSrc].sortants, idDest);
+    G_tableauIdsRetirer(pg->oriente ? &pg->adjacences[idDest].entrants : &pg->adjacences[idDest].sortants, idSrc);
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
   if (pvaleur != NULL) {
     THD_inserer(&pg->valeurs, &arc, pvaleur);
   }
+  errno = 0;
   return 0;
 }
 
-bool G_sommetPresent(G_Graphe g, unsigned int id) {
-  int sommetCourant;
-  int *temp;
-  for (int i = 0; i <= LCL_longueur(g.sommets)-1; ++i) {
-    temp = (int*)LCL_element(g.sommets, i);
-    sommetCourant = *temp;
-    free(temp);
-    if (sommetCourant == (int)id) {
-      return true;
+int G_ajouterArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *pvaleur) {
+  return G_ajouterArcPoids(pg, idSrc, idDest, pvaleur, 1.0f);
+}
+
+int G_activerPoids(G_Graphe *pg) {
+  if (pg->pondere) {
+    errno = 0;
+    return 0;
+  }
+  for (unsigned int id = 0; id < pg->nbAdjacences; id++) {
+    G_TableauIds *pt = &pg->adjacences[id].sortants;
+    if (pt->capacite > 0) {
+      pt->poids = malloc(pt->capacite * sizeof(float));
+      if (pt->poids == NULL) {
+        for (unsigned int i = 0; i < id; i++) {
+          free(pg->adjacences[i].sortants.poids);
+          pg->adjacences[i].sortants.poids = NULL;
+        }
+        errno = G_MEMOIRE_ERREUR;
+        return -1;
+      }
+      for (unsigned int i = 0; i < pt->nb; i++) {
+        pt->poids[i] = 1.0f;
+      }
     }
   }
-  return false;
+  pg->pondere = true;
+  errno = 0;
+  return 0;
 }
 
-bool G_arcPresent(G_Graphe g, unsigned int idSrc, unsigned int idDest) {
-  G_Arc arcCourant;
-  G_Arc *temp;
-  for (int i = 0; i <= LCL_longueur(g.arcs)-1; ++i) {
-    temp = (G_Arc*)LCL_element(g.arcs, i);
-    arcCourant = *temp;
-    free(temp);
-    if (arcCourant.src == (int)idSrc && arcCourant.dest == (int)idDest) {
-      return true;
+int G_ajouterArcPondere(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, float poids) {
+  if (!pg->pondere) {
+    errno = G_GRAPHE_NON_PONDERE_ERREUR;
+    return -1;
+  }
+  return G_ajouterArcPoids(pg, idSrc, idDest, NULL, poids);
+}
+
+float G_obtenirPoids(const G_Graphe *pg, unsigned int idSrc, unsigned int idDest) {
+  G_TableauIds voisins = G_sortants(pg, idSrc);
+  unsigned int i = G_tableauIdsPosition(voisins, idDest);
+  if (i == voisins.nb) {
+    errno = G_ARC_ERREUR;
+    return 0.0f;
+  }
+  errno = 0;
+  return pg->pondere ? voisins.poids[i] : 1.0f;
+}
+
+// Donne le poids p à toutes les occurrences de id, retourne le nombre d'occurrences modifiées
+static unsigned int G_tableauIdsFixerPoids(G_TableauIds t, unsigned int id, float p) {
+  unsigned int nbModifies = 0;
+  for (unsigned int i = 0; i < t.nb; i++) {
+    if (t.ids[i] == id) {
+      t.poids[i] = p;
+      nbModifies++;
     }
-    if (!g.oriente && arcCourant.src == (int)idDest && arcCourant.dest == (int)idSrc) {
-	return true;
+  }
+  return nbModifies;
+}
+
+int G_fixerPoids(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, float poids) {
+  if (!pg->pondere) {
+    errno = G_GRAPHE_NON_PONDERE_ERREUR;
+    return -1;
+  }
+  if (G_tableauIdsFixerPoids(G_sortants(pg, idSrc), idDest, poids) == 0) {
+    errno = G_ARC_ERREUR;
+    return -1;
+  }
+  if (!pg->oriente) {
+    G_tableauIdsFixerPoids(G_sortants(pg, idDest), idSrc, poids);
+  }
+  errno = 0;
+  return 0;
+}
+
+// Tri par base 256 (LSD) de clés 64 bits, tmp doit pouvoir contenir n clés
+static void G_trierCles(uint64_t *cles, uint64_t *tmp, size_t n) {
+  uint64_t cleMax = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (cles[i] > cleMax) cleMax = cles[i];
+  }
+  for (unsigned int decalage = 0; decalage < 64 && (cleMax >> decalage) != 0; decalage += 8) {
+    size_t compteurs[256 + 1] = {0};
+    for (size_t i = 0; i < n; i++) {
+      compteurs[((cles[i] >> decalage) & 0xFF) + 1]++;
     }
+    if (compteurs[((cles[0] >> decalage) & 0xFF) + 1] == n) {
+      continue; // toutes les clés ont ce même chiffre
+    }
+    for (size_t c = 0; c < 256; c++) {
+      compteurs[c + 1] += compteurs[c];
+    }
+    for (size_t i = 0; i < n; i++) {
+      tmp[compteurs[(cles[i] >> decalage) & 0xFF]++] = cles[i];
+    }
+    memcpy(cles, tmp, n * sizeof(uint64_t));
   }
-  return false;
+}
+
+// Ramène la liste des arcs à ses longueur premiers éléments (annulation d'un ajout groupé)
+static void G_tronquerArcs(G_Graphe *pg, unsigned int longueur) {
+  while ((unsigned int)LCL_longueur(pg->arcs) > longueur) {
+    LCL_supprimer(&pg->arcs, LCL_longueur(pg->arcs) - 1);
+  }
+}
+
+// Vrai si les deux ids de l'arc sont admis par le graphe (toujours vrai hors du mode dense)
+static bool G_arcAdmis(const G_Graphe *pg, G_Arc arc) {
+  return !pg->dense || (arc.src < pg->nbIdsDense && arc.dest < pg->nbIdsDense);
+}
+
+int G_ajouterArcs(G_Graphe *pg, const G_Arc *arcs, unsigned int nbArcs) {
+  // Un arc dont un id sort de la plage dense est écarté seul, comme un doublon : le reste du lot est ajouté
+  unsigned int idMax = 0;
+  unsigned int nbRejetes = 0;
+  for (unsigned int i = 0; i < nbArcs; i++) {
+    if (!G_arcAdmis(pg, arcs[i])) {
+      nbRejetes++;
+      continue;
+    }
+    if (arcs[i].src > idMax) idMax = arcs[i].src;
+    if (arcs[i].dest > idMax) idMax = arcs[i].dest;
+  }
+  pg->nbArcsRejetes += nbRejetes;
+  if (nbRejetes == nbArcs) {
+    errno = (nbRejetes > 0) ? G_SOMMET_ERREUR : 0;
+    return 0;
+  }
+  uint64_t *cles = malloc(nbArcs * sizeof(uint64_t));
+  uint64_t *tmp = malloc(nbArcs * sizeof(uint64_t));
+  unsigned int *nbNouveaux = calloc((size_t)idMax + 1, sizeof(unsigned int));
+  if (cles == NULL || tmp == NULL || nbNouveaux == NULL || !G_reserverAdjacence(pg, idMax)) {
+    free(cles);
+    free(tmp);
+    free(nbNouveaux);
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
+
+  // 1. Clés (src,dest), sous forme canonique (min,max) pour un graphe non orienté, triées puis dédoublonnées
+  unsigned int nbCles = 0;
+  for (unsigned int i = 0; i < nbArcs; i++) {
+    if (!G_arcAdmis(pg, arcs[i])) {
+      continue;
+    }
+    unsigned int a = arcs[i].src;
+    unsigned int b = arcs[i].dest;
+    if (!pg->oriente && a > b) {
+      a = arcs[i].dest;
+      b = arcs[i].src;
+    }
+    cles[nbCles++] = ((uint64_t)a << 32) | b;
+  }
+  G_trierCles(cles, tmp, nbCles);
+  free(tmp);
+  unsigned int nbUniques = 0;
+  for (unsigned int i = 0; i < nbCles; i++) {
+    unsigned int a = (unsigned int)(cles[i] >> 32);
+    unsigned int b = (unsigned int)cles[i];
+    G_Arc arc = {a, b};
+    if ((i > 0 && cles[i] == cles[i - 1]) || THD_contientRef(&pg->indexArcs, &arc)) {
+      continue;
+    }
+    cles[nbUniques++] = cles[i];
+    nbNouveaux[a]++;
+    if (a != b || pg->oriente) {
+      nbNouveaux[b]++;
+    }
+  }
+
+  // 2. Une seule réservation par sommet
+  bool ok = true;
+  for (unsigned int id = 0; id <= idMax && ok; id++) {
+    if (nbNouveaux[id] > 0) {
+      ok = G_tableauIdsReserver(&pg->adjacences[id].sortants, nbNouveaux[id], pg->pondere);
+      if (ok && pg->oriente) {
+	ok = G_tableauIdsReserver(&pg->adjacences[id].entrants, nbNouveaux[id], false);
+      }
+    }
+  }
+  free(nbNouveaux);
+
+  // 3. Nouveaux arcs en fin de liste, après une seule réservation
+  unsigned int longueurInitiale = (unsigned int)LCL_longueur(pg->arcs);
+  if (ok) {
+    LCL_reserver(&pg->arcs, longueurInitiale + nbUniques);
+    ok = (errno == 0);
+  }
+  for (unsigned int i = 0; i < nbUniques && ok; i++) {
+    G_Arc arc;
+    arc.src = (unsigned int)(cles[i] >> 32);
+    arc.dest = (unsigned int)cles[i];
+    LCL_ajouterFin(&pg->arcs, &arc);
+    ok = (errno == 0);
+  }
+  if (!ok) {
+    G_tronquerArcs(pg, longueurInitiale);
+    free(cles);
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
+
+  // 4. Index puis remplissage des adjacences (place déjà réservée)
+  for (unsigned int i = 0; i < nbUniques && ok; i++) {
+    G_Arc arc;
+    arc.src = (unsigned int)(cles[i] >> 32);
+    arc.dest = (unsigned int)cles[i];
+    unsigned int position = longueurInitiale + i;
+    THD_inserer(&pg->indexArcs, &arc, &position);
+    ok = (errno == 0);
+    if (!ok) {
+      for (unsigned int j = 0; j < i; j++) {
+        arc.src = (unsigned int)(cles[j] >> 32);
+        arc.dest = (unsigned int)cles[j];
+        THD_supprimer(&pg->indexArcs, &arc);
+      }
+    }
+  }
+  if (!ok) {
+    G_tronquerArcs(pg, longueurInitiale);
+    free(cles);
+    errno = G_MEMOIRE_ERREUR;
+    return -1;
+  }
+  for (unsigned int i = 0; i < nbUniques; i++) {
+    unsigned int a = (unsigned int)(cles[i] >> 32);
+    unsigned int b = (unsigned int)cles[i];
+    G_tableauIdsAjouter(&pg->adjacences[a].sortants, b, pg->pondere, 1.0f);
+    if (pg->oriente) {
+      G_tableauIdsAjouter(&pg->adjacences[b].entrants, a, false, 0.0f);
+    } else if (a != b) {
+      G_tableauIdsAjouter(&pg->adjacences[b].sortants, a, pg->pondere, 1.0f);
+    }
+  }
+  free(cles);
+  errno = (nbRejetes > 0) ? G_SOMMET_ERREUR : 0;
+  return nbUniques;
+}
+
+bool G_sommetPresent(G_Graphe g, unsigned int id) {
+  return G_estPresent(&g, id);
+}
+
+bool G_arcPresent(G_Graphe g, unsigned int idSrc, unsigned int idDest) {
+  return G_arcPresentRef(&g, idSrc, idDest);
+}
+
+bool G_arcPresentRef(const G_Graphe *pg, unsigned int idSrc, unsigned int idDest) {
+  G_Arc arc = G_arcCanonique(pg->oriente, idSrc, idDest);
+  return THD_contientRef(&pg->indexArcs, &arc);
+}
+
+// Retire un arc présent de la liste des arcs (le dernier arc prend sa place) et de l'index, et libère sa valeur
+static void G_retirerArcDeLaListe(G_Graphe *pg, unsigned int idSrc, unsigned int idDest) {
+  G_Arc arcCanonique = G_arcCanonique(pg->oriente, idSrc, idDest);
+  unsigned int position = *(const unsigned int*)THD_valeurEmprunteeRef(&pg->indexArcs, &arcCanonique);
+  THD_supprimer(&pg->indexArcs, &arcCanonique);
+  G_Arc *parc = (G_Arc*)pg->arcs.elements[position];
+  if (pg->copierValeur != NULL) {
+    THD_supprimer(&pg->valeurs, parc);
+  }
+  pg->arcs.supprimerElement(parc);
+  unsigned int derniere = (unsigned int)pg->arcs.longueur - 1;
+  if (position != derniere) {
+    G_Arc *pdeplace = (G_Arc*)pg->arcs.elements[derniere];
+    G_Arc arcDeplace = G_arcCanonique(pg->oriente, pdeplace->src, pdeplace->dest);
+    *(unsigned int*)THD_referenceValeur(&pg->indexArcs, &arcDeplace) = position;
+    pg->arcs.elements[position] = pdeplace;
+  }
+  pg->arcs.longueur--;
 }
 
 static void G_supprimerArcsDUnSommet(G_Graphe *pg, unsigned int id) {
-  for(int i=0; i<=LCL_longueur(pg->arcs)-1; i++) {
-    G_Arc *temp = (G_Arc*)LCL_element(pg->arcs, i);
-    if(temp->src == (int)id || temp->dest == (int)id) {
-      LCL_supprimer(&pg->arcs, i);
-      free(temp);
-      i--;
+  if (id >= pg->nbAdjacences) {
+    return;
+  }
+  G_Adjacence *padj = &pg->adjacences[id];
+  if (padj->sortants.nb == 0 && padj->entrants.nb == 0) {
+    return;
+  }
+  for (unsigned int i = 0; i < padj->sortants.nb; i++) {
+    unsigned int voisin = padj->sortants.ids[i];
+    G_retirerArcDeLaListe(pg, id, voisin);
+    if (voisin == id) {
+      continue; // boucle : les tableaux de id sont libérés plus bas
+    }
+    if (pg->oriente) {
+      G_tableauIdsRetirer(&pg->adjacences[voisin].entrants, id);
     } else {
-      free(temp);
+      G_tableauIdsRetirer(&pg->adjacences[voisin].sortants, id);
     }
   }
+  for (unsigned int i = 0; i < padj->entrants.nb; i++) {
+    if (padj->entrants.ids[i] != id) {
+      G_retirerArcDeLaListe(pg, padj->entrants.ids[i], id);
+      G_tableauIdsRetirer(&pg->adjacences[padj->entrants.ids[i]].sortants, id);
+    }
+  }
+  G_tableauIdsLiberer(&padj->sortants);
+  G_tableauIdsLiberer(&padj->entrants);
 }
 
 static void G_supprimerEtiquetteDUnSommet(G_Graphe *pg, unsigned int id) {
   THD_supprimer(&pg->etiquettes, &id);
 }
 
+static int G_supprimerSommetDense(G_Graphe *pg, unsigned int id) {
+  if (!G_estPresent(pg, id)) {
+    errno = G_SOMMET_ERREUR;
+    return -1;
+  }
+  pg->presence[id / 8] &= (unsigned char)~(1U << (id % 8));
+  pg->nbSommets--;
+  G_supprimerArcsDUnSommet(pg, id);
+  if (pg->etiquettesDenses != NULL && pg->etiquettesDenses[id] != NULL) {
+    pg->libererEtiquette(pg->etiquettesDenses[id]);
+    pg->etiquettesDenses[id] = NULL;
+  }
+  errno = 0;
+  return 0;
+}
+
 int G_supprimerSommet(G_Graphe *pg, unsigned int id) {
+  if (pg->dense) {
+    return G_supprimerSommetDense(pg, id);
+  }
   bool trouve = false;
-  for(int i=0; i<=LCL_longueur(pg->sommets)-1; i++) {
-    int *temp = (int*)LCL_element(pg->sommets, i);
-    if(*temp == (int)id) {
-      LCL_supprimer(&pg->sommets, i);
-      free(temp);
+  unsigned int position = 0;
+  while (position < (unsigned int)LCL_longueur(pg->sommets)) {
+    if (*(const int*)LCL_elementEmprunte(&pg->sommets, position) == (int)id) {
       trouve = true;
       break;
     }
-    free(temp);
+    position++;
   }
   if(!trouve) {
     errno = G_SOMMET_ERREUR;
     return -1;
   } 
+  LCL_supprimer(&pg->sommets, position);
   G_supprimerArcsDUnSommet(pg, id);
   if (pg->copierEtiquette != NULL)
     G_supprimerEtiquetteDUnSommet(pg, id);
+  errno = 0;
   return 0;
 }
 
 int G_supprimerArc(G_Graphe *pg, unsigned int idSrc, unsigned int idDest) {
-  int res = -1;
-  for(int i=0; i<=LCL_longueur(pg->arcs)-1; i++) {
-    G_Arc *temp = (G_Arc*)LCL_element(pg->arcs, i);
-    if(temp->src == (int)idSrc && temp->dest == (int)idDest) {
-      LCL_supprimer(&pg->arcs, i);
-      res = 0;
-    }
-    if(!pg->oriente && temp->src == (int)idDest && temp->dest == (int)idSrc) {
-      LCL_supprimer(&pg->arcs, i);
-      res = 0;
-    }
-    free(temp);
+  if (idSrc >= pg->nbAdjacences || idDest >= pg->nbAdjacences ||
+      G_tableauIdsRetirer(&pg->adjacences[idSrc].sortants, idDest) == 0) {
+    errno = G_ARC_ERREUR;
+    return -1;
   }
-  if (res == 0 && pg->copierValeur != NULL) {
-    G_Arc arc;
-    arc.src = idSrc;
-    arc.dest = idDest;
-    THD_supprimer(&pg->valeurs, &arc);
-    if (!pg->oriente) {
-      G_Arc arcInverse;
-      arcInverse.src = idDest;
-      arcInverse.dest = idSrc;
-      THD_supprimer(&pg->valeurs, &arcInverse);
-    }
+  if (pg->oriente) {
+    G_tableauIdsRetirer(&pg->adjacences[idDest].entrants, idSrc);
+  } else {
+    G_tableauIdsRetirer(&pg->adjacences[idDest].sortants, idSrc);
   }
-  return res;
+  G_retirerArcDeLaListe(pg, idSrc, idDest);
+  errno = 0;
+  return 0;
 }
 
 LCL_Liste G_sommets(G_Graphe g) {
-  return LCL_copier(g.sommets);
+  if (!g.dense) {
+    return LCL_copier(g.sommets);
+  }
+  LCL_Liste res = LCL_liste(CLCTS_copierInt, CLCTS_libererInt);
+  // Ajouts en fin, ids croissants
+  LCL_reserver(&res, g.nbSommets);
+  for (unsigned int id = 0; id < g.nbIdsDense; id++) {
+    if (G_estPresentDansBitmap(g.presence, id)) {
+      LCL_ajouterFin(&res, &id);
+    }
+  }
+  return res;
 }
 
 LCL_Liste G_obtenirSommetsAdjacents(G_Graphe g, unsigned int idSrc) {
   LCL_Liste res = LCL_liste(CLCTS_copierInt, CLCTS_libererInt);
-  for(int i=0; i<=LCL_longueur(g.arcs)-1; i++) {
-    G_Arc *temp = (G_Arc*)LCL_element(g.arcs, i);
-    if(temp->src == (int)idSrc) {
-      LCL_inserer(&res, &temp->dest, LCL_longueur(res));
-    }
-    if(!g.oriente && temp->dest == (int)idSrc) {
-      LCL_inserer(&res, &temp->src, LCL_longueur(res));
-    }
-    free(temp);
+  G_TableauIds voisins = G_sortants(&g, idSrc);
+  // Ajouts en fin, dans l'ordre des arcs
+  LCL_reserver(&res, voisins.nb);
+  for (unsigned int i = 0; i < voisins.nb; i++) {
+    LCL_ajouterFin(&res, &voisins.ids[i]);
   }
   return res;
 }
 
+G_IterateurVoisins G_iterateurVoisins(const G_Graphe *pg, unsigned int id) {
+  G_IterateurVoisins it;
+  G_TableauIds voisins = G_sortants(pg, id);
+  it.courant = voisins.ids;
+  it.fin = (voisins.nb > 0) ? voisins.ids + voisins.nb : voisins.ids;
+  it.poids = voisins.poids;
+  return it;
+}
+
+G_IterateurVoisins G_iterateurVoisinsFige(const G_GrapheFige *pgf, unsigned int id) {
+  G_IterateurVoisins it;
+  unsigned int nbVoisins;
+  it.courant = G_figeVoisins(pgf, id, &nbVoisins);
+  it.fin = (it.courant != NULL) ? it.courant + nbVoisins : NULL;
+  it.poids = (it.courant != NULL && pgf->poids != NULL) ? pgf->poids + pgf->debuts[id] : NULL;
+  return it;
+}
+
+bool G_voisinSuivant(G_IterateurVoisins *pit, unsigned int *pid) {
+  if (pit->courant == pit->fin) {
+    return false;
+  }
+  *pid = *pit->courant++;
+  if (pit->poids != NULL) {
+    pit->poids++;
+  }
+  return true;
+}
+
+bool G_voisinSuivantPondere(G_IterateurVoisins *pit, unsigned int *pid, float *ppoids) {
+  if (pit->courant == pit->fin) {
+    return false;
+  }
+  *pid = *pit->courant++;
+  *ppoids = (pit->poids != NULL) ? *pit->poids++ : 1.0f;
+  return true;
+}
+
 void* G_obtenirEtiquette(G_Graphe g, unsigned int id) {
   if (g.copierEtiquette == NULL) {
     errno = G_GRAPHE_NON_ETIQUETE_ERREUR;
     return NULL;
   }
   void *petiquette = NULL;
-  if (THD_contient(g.etiquettes, &id)) {
-    petiquette = THD_valeur(g.etiquettes, &id);
+  if (g.dense) {
+    if (id < g.nbIdsDense && g.etiquettesDenses[id] != NULL) {
+      petiquette = g.copierEtiquette(g.etiquettesDenses[id]);
+    } else {
+      errno = G_SOMMET_ERREUR;
+    }
+  } else if (THD_contientRef(&g.etiquettes, &id)) {
+    petiquette = THD_valeurRef(&g.etiquettes, &id);
   } else {
     errno = G_SOMMET_ERREUR;
   }
@@ -239,6 +808,22 @@ int G_fixerEtiquette(G_Graphe *pg, unsigned int id, void *petiquette) {
     errno = G_GRAPHE_NON_ETIQUETE_ERREUR;
     return -1;
   }
+  if (pg->dense) {
+    if (id >= pg->nbIdsDense) {
+      errno = G_SOMMET_ERREUR;
+      return -1;
+    }
+    void *pcopie = pg->copierEtiquette(petiquette);
+    if (pcopie == NULL) {
+      errno = G_MEMOIRE_ERREUR;
+      return -1;
+    }
+    if (pg->etiquettesDenses[id] != NULL) {
+      pg->libererEtiquette(pg->etiquettesDenses[id]);
+    }
+    pg->etiquettesDenses[id] = pcopie;
+    return 0;
+  }
   THD_inserer(&pg->etiquettes, &id, petiquette);
   return 0;
 }
@@ -253,12 +838,12 @@ void* G_obtenirValeur(G_Graphe g, unsigned int idSrc, unsigned int idDest) {
   arc.dest = idDest;
   arcInverse.src = idDest;
   arcInverse.dest = idSrc;
-  void *pvaleur = NULL;
-  if (THD_contient(g.valeurs, &arc)) {
-    pvaleur = THD_valeur(g.valeurs, &arc);
-  } else if (!g.oriente && THD_contient(g.valeurs, &arcInverse)) {
-    pvaleur = THD_valeur(g.valeurs, &arcInverse);
-  } else {
+  // THD_valeurRef retourne NULL si la clé est absente : une seule recherche par sens
+  void *pvaleur = THD_valeurRef(&g.valeurs, &arc);
+  if (pvaleur == NULL && !g.oriente) {
+    pvaleur = THD_valeurRef(&g.valeurs, &arcInverse);
+  }
+  if (pvaleur == NULL) {
     errno = G_ARC_ERREUR;
   }
   return pvaleur;
@@ -274,8 +859,8 @@ int G_fixerValeur(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *p
   arc.dest = idDest;
   arcInverse.src = idDest;
   arcInverse.dest = idSrc;
-  if (!THD_contient(pg->valeurs, &arc)) {
-    if (!pg->oriente && THD_contient(pg->valeurs, &arcInverse) == false) {
+  if (!THD_contientRef(&pg->valeurs, &arc)) {
+    if (!pg->oriente && THD_contientRef(&pg->valeurs, &arcInverse) == false) {
       errno = G_ARC_ERREUR;
       return -1;
     }
@@ -291,9 +876,316 @@ int G_fixerValeur(G_Graphe *pg, unsigned int idSrc, unsigned int idDest, void *p
 void G_vider(G_Graphe *pg) {
   LCL_vider(&pg->sommets);
   LCL_vider(&pg->arcs);
+  THD_vider(&pg->indexArcs);
+  pg->nbArcsEnDouble = 0;
+  pg->nbArcsRejetes = 0;
+  for (unsigned int id = 0; id < pg->nbAdjacences; id++) {
+    G_tableauIdsLiberer(&pg->adjacences[id].sortants);
+    G_tableauIdsLiberer(&pg->adjacences[id].entrants);
+  }
+  free(pg->adjacences);
+  pg->adjacences = NULL;
+  pg->nbAdjacences = 0;
+  if (pg->etiquettesDenses != NULL) {
+    for (unsigned int id = 0; id < pg->nbIdsDense; id++) {
+      if (pg->etiquettesDenses[id] != NULL) {
+	pg->libererEtiquette(pg->etiquettesDenses[id]);
+      }
+    }
+  }
+  free(pg->etiquettesDenses);
+  free(pg->presence);
+  pg->etiquettesDenses = NULL;
+  pg->presence = NULL;
+  pg->nbIdsDense = 0;
+  pg->nbSommets = 0;
   THD_vider(&pg->etiquettes);
   THD_vider(&pg->valeurs);
 }
 
 
 
+
+static G_GrapheFige G_grapheFigeVide(bool oriente) {
+  G_GrapheFige gf;
+  gf.oriente = oriente;
+  gf.nbIds = 0;
+  gf.nbEntrees = 0;
+  gf.debuts = NULL;
+  gf.voisins = NULL;
+  gf.poids = NULL;
+  gf.zone = NULL;
+  gf.tailleZone = 0;
+  return gf;
+}
+
+static int G_comparerIds(const void* pid1, const void* pid2) {
+  unsigned int id1 = *(const unsigned int*)pid1;
+  unsigned int id2 = *(const unsigned int*)pid2;
+  return (id1 > id2) - (id1 < id2);
+}
+
+typedef struct {
+  unsigned int id;
+  float poids;
+} G_VoisinPondere;
+
+static int G_comparerVoisinsPonderes(const void* pv1, const void* pv2) {
+  return G_comparerIds(&((const G_VoisinPondere*)pv1)->id, &((const G_VoisinPondere*)pv2)->id);
+}
+
+G_GrapheFige G_figer(G_Graphe g) {
+  G_GrapheFige gf = G_grapheFigeVide(g.oriente);
+  unsigned int idMax = 0;
+  bool vide = true;
+
+  // 1. Plage des ids : sommets déclarés et sommets ayant des arcs
+  for (unsigned int id = g.nbIdsDense; id > 0 && vide; id--) {
+    if (G_estPresentDansBitmap(g.presence, id - 1)) {
+      idMax = id - 1;
+      vide = false;
+    }
+  }
+  for (unsigned int i = 0; i < (unsigned int)LCL_longueur(g.sommets); i++) {
+    unsigned int id = *(const unsigned int*)LCL_elementEmprunte(&g.sommets, i);
+    if (vide || id > idMax) idMax = id;
+    vide = false;
+  }
+  for (unsigned int id = g.nbAdjacences; id > 0; id--) {
+    if (g.adjacences[id - 1].sortants.nb > 0 || g.adjacences[id - 1].entrants.nb > 0) {
+      if (vide || id - 1 > idMax) idMax = id - 1;
+      vide = false;
+      break;
+    }
+  }
+  if (vide) {
+    errno = 0;
+    return gf;
+  }
+  gf.nbIds = idMax + 1;
+  gf.debuts = calloc((size_t)gf.nbIds + 1, sizeof(unsigned int));
+  if (gf.debuts == NULL) {
+    errno = G_MEMOIRE_ERREUR;
+    return G_grapheFigeVide(g.oriente);
+  }
+
+  // 2. Degrés (décalés d'une case), lus dans les adjacences, puis sommes préfixes
+  unsigned int degreMax = 0;
+  for (unsigned int id = 0; id < gf.nbIds; id++) {
+    unsigned int degre = G_sortants(&g, id).nb;
+    gf.debuts[id + 1] = gf.debuts[id] + degre;
+    if (degre > degreMax) degreMax = degre;
+  }
+  gf.nbEntrees = gf.debuts[gf.nbIds];
+  gf.voisins = malloc((gf.nbEntrees > 0 ? gf.nbEntrees : 1) * sizeof(unsigned int));
+  G_VoisinPondere *tampon = NULL;
+  if (g.pondere) {
+    gf.poids = malloc((gf.nbEntrees > 0 ? gf.nbEntrees : 1) * sizeof(float));
+    tampon = malloc((degreMax > 0 ? degreMax : 1) * sizeof(G_VoisinPondere));
+  }
+  if (gf.voisins == NULL || (g.pondere && (gf.poids == NULL || tampon == NULL))) {
+    free(tampon);
+    G_libererFige(&gf);
+    errno = G_MEMOIRE_ERREUR;
+    return gf;
+  }
+
+  // 3. Copie, tri de chaque liste et fusion des doublons (en gardant le plus petit poids)
+  unsigned int ecriture = 0;
+  for (unsigned int id = 0; id < gf.nbIds; id++) {
+    G_TableauIds voisins = G_sortants(&g, id);
+    gf.debuts[id] = ecriture;
+    if (g.pondere) {
+      for (unsigned int i = 0; i < voisins.nb; i++) {
+        tampon[i].id = voisins.ids[i];
+        tampon[i].poids = voisins.poids[i];
+      }
+      qsort(tampon, voisins.nb, sizeof(G_VoisinPondere), G_comparerVoisinsPonderes);
+      for (unsigned int i = 0; i < voisins.nb; i++) {
+        if (i == 0 || tampon[i].id != tampon[i - 1].id) {
+          gf.voisins[ecriture] = tampon[i].id;
+          gf.poids[ecriture++] = tampon[i].poids;
+        } else if (tampon[i].poids < gf.poids[ecriture - 1]) {
+          gf.poids[ecriture - 1] = tampon[i].poids;
+        }
+      }
+    } else if (voisins.nb > 0) {
+      unsigned int *debut = gf.voisins + ecriture;
+      memcpy(debut, voisins.ids, voisins.nb * sizeof(unsigned int));
+      qsort(debut, voisins.nb, sizeof(unsigned int), G_comparerIds);
+      for (unsigned int i = 0; i < voisins.nb; i++) {
+        if (i == 0 || debut[i] != gf.voisins[ecriture - 1]) {
+          gf.voisins[ecriture++] = debut[i];
+        }
+      }
+    }
+  }
+  free(tampon);
+  gf.debuts[gf.nbIds] = ecriture;
+  gf.nbEntrees = ecriture;
+
+  errno = 0;
+  return gf;
+}
+
+const unsigned int* G_figeVoisins(const G_GrapheFige* pgf, unsigned int id, unsigned int* pnbVoisins) {
+  if (id >= pgf->nbIds || pgf->debuts[id] == pgf->debuts[id + 1]) {
+    *pnbVoisins = 0;
+    return NULL;
+  }
+  *pnbVoisins = pgf->debuts[id + 1] - pgf->debuts[id];
+  return pgf->voisins + pgf->debuts[id];
+}
+
+unsigned int G_figeDegre(const G_GrapheFige* pgf, unsigned int id) {
+  if (id >= pgf->nbIds) {
+    return 0;
+  }
+  return pgf->debuts[id + 1] - pgf->debuts[id];
+}
+
+bool G_figeArcPresent(const G_GrapheFige* pgf, unsigned int idSrc, unsigned int idDest) {
+  unsigned int nbVoisins;
+  const unsigned int *voisins = G_figeVoisins(pgf, idSrc, &nbVoisins);
+  return voisins != NULL &&
+    bsearch(&idDest, voisins, nbVoisins, sizeof(unsigned int), G_comparerIds) != NULL;
+}
+
+#define G_SIGNATURE_FIGE 0x47494647U // "GFIG" lu comme un entier petit-boutiste
+#define G_VERSION_FIGE 1U
+#define G_MARQUEUR_OCTETS 0x01020304U
+#define G_FIGE_ORIENTE 1U
+#define G_FIGE_PONDERE 2U
+#define G_TAILLE_ENTETE_FIGE (6 * sizeof(uint32_t))
+
+int G_ecrireFige(const G_GrapheFige* pgf, FILE* flux) {
+  uint32_t entete[6];
+  entete[0] = G_SIGNATURE_FIGE;
+  entete[1] = G_VERSION_FIGE;
+  entete[2] = G_MARQUEUR_OCTETS;
+  entete[3] = (pgf->oriente ? G_FIGE_ORIENTE : 0U) | (pgf->poids != NULL ? G_FIGE_PONDERE : 0U);
+  entete[4] = pgf->nbIds;
+  entete[5] = pgf->nbEntrees;
+  size_t nbDebuts = (pgf->nbIds > 0) ? (size_t)pgf->nbIds + 1 : 0;
+  if (fwrite(entete, sizeof(uint32_t), 6, flux) != 6 ||
+      fwrite(pgf->debuts, sizeof(unsigned int), nbDebuts, flux) != nbDebuts ||
+      fwrite(pgf->voisins, sizeof(unsigned int), pgf->nbEntrees, flux) != pgf->nbEntrees ||
+      (pgf->poids != NULL && fwrite(pgf->poids, sizeof(float), pgf->nbEntrees, flux) != pgf->nbEntrees)) {
+    errno = G_FICHIER_ERREUR;
+    return -1;
+  }
+  errno = 0;
+  return 0;
+}
+
+// Vérifie que les positions découpent le tableau des voisins dans l'ordre, et que chaque voisin est un identifiant connu
+static bool G_tableauxFigesValides(const G_GrapheFige* pgf) {
+  if (pgf->debuts[0] != 0 || pgf->debuts[pgf->nbIds] != pgf->nbEntrees) {
+    return false;
+  }
+  for (unsigned int i = 0; i < pgf->nbIds; i++) {
+    if (pgf->debuts[i] > pgf->debuts[i + 1]) {
+      return false;
+    }
+  }
+  for (unsigned int k = 0; k < pgf->nbEntrees; k++) {
+    if (pgf->voisins[k] >= pgf->nbIds) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int G_lireFige(const void* zone, size_t taille, G_GrapheFige* pgf, size_t* ptailleLue) {
+  const uint32_t *entete = (const uint32_t*)zone;
+  if (taille < G_TAILLE_ENTETE_FIGE || entete[0] != G_SIGNATURE_FIGE || entete[1] != G_VERSION_FIGE ||
+      entete[2] != G_MARQUEUR_OCTETS || (entete[3] & ~(G_FIGE_ORIENTE | G_FIGE_PONDERE)) != 0) {
+    errno = G_FICHIER_ERREUR;
+    return -1;
+  }
+  bool pondere = (entete[3] & G_FIGE_PONDERE) != 0;
+  size_t nbDebuts = (entete[4] > 0) ? (size_t)entete[4] + 1 : 0;
+  size_t tailleLue = G_TAILLE_ENTETE_FIGE + nbDebuts * sizeof(unsigned int) +
+    (size_t)entete[5] * (sizeof(unsigned int) + (pondere ? sizeof(float) : 0));
+  if (taille < tailleLue) {
+    errno = G_FICHIER_ERREUR;
+    return -1;
+  }
+  unsigned int *tableaux = (unsigned int*)(entete + 6);
+  G_GrapheFige gf = G_grapheFigeVide((entete[3] & G_FIGE_ORIENTE) != 0);
+  gf.nbIds = entete[4];
+  gf.nbEntrees = entete[5];
+  if (gf.nbIds > 0) {
+    gf.debuts = tableaux;
+    gf.voisins = tableaux + nbDebuts;
+    // Les positions doivent rester dans le tableau des voisins, sans quoi G_figeVoisins lirait hors de la zone
+    if (!G_tableauxFigesValides(&gf)) {
+      errno = G_FICHIER_ERREUR;
+      return -1;
+    }
+    if (pondere) {
+      gf.poids = (float*)(gf.voisins + gf.nbEntrees);
+    }
+  } else if (gf.nbEntrees > 0) {
+    errno = G_FICHIER_ERREUR;
+    return -1;
+  }
+  *pgf = gf;
+  *ptailleLue = tailleLue;
+  errno = 0;
+  return 0;
+}
+
+int G_sauvegarder(const G_GrapheFige* pgf, const char* nomFichier) {
+  FILE *flux = fopen(nomFichier, "wb");
+  if (flux == NULL) {
+    errno = G_FICHIER_ERREUR;
+    return -1;
+  }
+  int res = G_ecrireFige(pgf, flux);
+  if (fclose(flux) != 0) {
+    res = -1;
+  }
+  errno = (res == 0) ? 0 : G_FICHIER_ERREUR;
+  return res;
+}
+
+G_GrapheFige G_charger(const char* nomFichier) {
+  G_GrapheFige gf = G_grapheFigeVide(false);
+  int fd = open(nomFichier, O_RDONLY);
+  struct stat infos;
+  if (fd < 0 || fstat(fd, &infos) != 0 || infos.st_size < (off_t)G_TAILLE_ENTETE_FIGE) {
+    if (fd >= 0) close(fd);
+    errno = G_FICHIER_ERREUR;
+    return gf;
+  }
+  size_t taille = (size_t)infos.st_size;
+  void *zone = mmap(NULL, taille, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // la projection reste valide après la fermeture
+  size_t tailleLue;
+  if (zone == MAP_FAILED) {
+    errno = G_FICHIER_ERREUR;
+    return gf;
+  }
+  if (G_lireFige(zone, taille, &gf, &tailleLue) != 0) {
+    munmap(zone, taille);
+    errno = G_FICHIER_ERREUR;
+    return G_grapheFigeVide(false);
+  }
+  gf.zone = zone;
+  gf.tailleZone = taille;
+  errno = 0;
+  return gf;
+}
+
+void G_libererFige(G_GrapheFige* pgf) {
+  if (pgf->zone != NULL) {
+    munmap(pgf->zone, pgf->tailleZone);
+    *pgf = G_grapheFigeVide(pgf->oriente);
+    return;
+  }
+  free(pgf->debuts);
+  free(pgf->voisins);
+  free(pgf->poids);
+  *pgf = G_grapheFigeVide(pgf->oriente);
+}
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include "listeChainee.h"
+#include "allocateurBlocs.h"
 
 LC_ListeChainee LC_listeChainee(){
   errno=0;
@@ -16,13 +17,26 @@ int LC_estVide(LC_ListeChainee l) {
 }
 
 void LC_ajouter(LC_ListeChainee* pl, void* source, CLC_FonctionCopier copierElement) {
-  LC_ListeChainee pNoeud=(LC_ListeChainee)malloc(sizeof(LC_Noeud));
-  void* donnee=copierElement(source);
+  LC_ListeChainee pNoeud=(LC_ListeChainee)AB_allouer(sizeof(LC_Noeud));
+  void* donnee=(pNoeud!=NULL) ? copierElement(source) : NULL;
   if ((pNoeud!=NULL) && (donnee!=NULL)) {
       errno=0;
       pNoeud->lElement=donnee;
       pNoeud->listeSuivante=*pl;
       *pl=pNoeud;
+  } else {
+    AB_liberer(pNoeud,sizeof(LC_Noeud));
+    errno=LC_ERREUR_MEMOIRE;
+  }
+}
+
+void LC_ajouterPrendre(LC_ListeChainee* pl, void* element) {
+  LC_ListeChainee pNoeud=(LC_ListeChainee)AB_allouer(sizeof(LC_Noeud));
+  if (pNoeud!=NULL) {
+      errno=0;
+      pNoeud->lElement=element;
+      pNoeud->listeSuivante=*pl;
+      *pl=pNoeud;
   } else {
     errno=LC_ERREUR_MEMOIRE;
   }
@@ -67,7 +81,19 @@ void LC_supprimerTete(LC_ListeChainee* pl, CLC_FonctionLiberer libererElement){
   temp=*pl;
   *pl=LC_obtenirListeSuivante(*pl);
   libererElement(LC_obtenirElement(temp));
-  free(temp);
+  AB_liberer(temp,sizeof(LC_Noeud));
+}
+
+void* LC_supprimerTetePrendre(LC_ListeChainee* pl){
+  LC_ListeChainee temp;
+  void* element;
+  assert(!LC_estVide(*pl));
+  errno=0;
+  temp=*pl;
+  *pl=LC_obtenirListeSuivante(*pl);
+  element=LC_obtenirElement(temp);
+  AB_liberer(temp,sizeof(LC_Noeud));
+  return element;
 }
 
 void LC_supprimer(LC_ListeChainee* pl, CLC_FonctionLiberer libererElement){
@@ -1,102 +1,245 @@
 #include <stdlib.h>
+#include <stdint.h>
 #include <errno.h>
 #include <stddef.h>
+#include <string.h>
+#include <limits.h>
 #include "tableHachage.h"
 
 /* -------------------------------------------------------------------------- */
 /*                 FONCTIONS / VARIABLES PRIVEES AU MODULE                    */
 /* -------------------------------------------------------------------------- */
 
-typedef struct {
-  void* pcle;
-  void* pvaleur;
-} TH_CleValeur;
+#define TH_MULTIPLICATEUR 0x9E3779B97F4A7C15ULL /* 2^64 / nombre d'or, impair */
 
+/* Haché de la clé selon la fonction de la table. En ligne, seuls 32 bits sont conservés
+   dans la case et la valeur 0 y marque une case vide : elle est remplacée par 1 */
+static size_t TH_hash(const TH_TableHachage* ptableHachage, void* pcle) {
+  size_t hache;
 
-static unsigned char TH_hash(const void* pcle, size_t tailleCle) {
-  const unsigned char* p;
-  size_t i;
-  unsigned int somme;
+  hache = ptableHachage->hacher(pcle, ptableHachage->tailleCle);
+  if (ptableHachage->enLigne) {
+    hache = (uint32_t)hache;
+    if (hache == 0U) {
+      hache = 1U;
+    }
+  }
+  return hache;
+}
 
-  p = (const unsigned char*)pcle;
-  somme = 0U;
-  for (i = 0U; i < tailleCle; ++i) {
-    somme += (unsigned int)p[i];
+/* Plus grand alignement (au plus 8) compatible avec un objet de cette taille */
+static size_t TH_alignement(size_t taille) {
+  size_t alignement;
+
+  if (taille == 0U) {
+    return 1U;
+  }
+  alignement = 8U;
+  while (taille % alignement != 0U) {
+    alignement /= 2U;
   }
-  return (unsigned char)somme;
+  return alignement;
 }
 
-/* Ces pointeurs sont utilisés temporairement par TH_copierCleValeurProfondeur et TH_libererCleValeurProfondeur().
-   On les POSITIONNE juste avant d'appeler ces deux fonctions. (Hypothèse mono-thread / contexte pédagogique.) */
-static CLC_FonctionCopier g_copierCle = NULL;
-static CLC_FonctionCopier g_copierValeur = NULL;
-static CLC_FonctionLiberer g_libererCle = NULL;
-static CLC_FonctionLiberer g_libererValeur = NULL;
+static size_t TH_arrondir(size_t n, size_t multiple) {
+  return (n + multiple - 1U) / multiple * multiple;
+}
 
+/* Début de la case i d'une table en ligne */
+static unsigned char* TH_caseEnLigne(const TH_TableHachage* ptableHachage, unsigned int i) {
+  return ptableHachage->donnees + (size_t)i * ptableHachage->tailleCase;
+}
 
-static void* TH_copierCleValeurProfondeur(void* pcleValeur) {
-  TH_CleValeur* pSrc;
-  TH_CleValeur* pDst;
+static uint32_t TH_hacheEnLigne(const TH_TableHachage* ptableHachage, unsigned int i) {
+  uint32_t hache;
 
-  pSrc = (TH_CleValeur*)pcleValeur;
-  pDst = (TH_CleValeur*)malloc(sizeof(TH_CleValeur));
-  if (pDst == NULL) {
-    return NULL;
+  memcpy(&hache, TH_caseEnLigne(ptableHachage, i) + ptableHachage->decalageHache, sizeof(uint32_t));
+  return hache;
+}
+
+/* Accès aux cases, quel que soit le mode de rangement */
+static bool TH_caseOccupee(const TH_TableHachage* ptableHachage, unsigned int i) {
+  if (ptableHachage->enLigne) {
+    return TH_hacheEnLigne(ptableHachage, i) != 0U;
+  }
+  return ptableHachage->cases[i].pcle != NULL;
+}
+
+static size_t TH_hacheCase(const TH_TableHachage* ptableHachage, unsigned int i) {
+  return ptableHachage->enLigne ? TH_hacheEnLigne(ptableHachage, i) : ptableHachage->cases[i].hache;
+}
+
+static void* TH_cleCase(const TH_TableHachage* ptableHachage, unsigned int i) {
+  return ptableHachage->enLigne ? (void*)TH_caseEnLigne(ptableHachage, i) : ptableHachage->cases[i].pcle;
+}
+
+static void* TH_valeurCase(const TH_TableHachage* ptableHachage, unsigned int i) {
+  if (ptableHachage->enLigne) {
+    return TH_caseEnLigne(ptableHachage, i) + ptableHachage->decalageValeur;
+  }
+  return ptableHachage->cases[i].pvaleur;
+}
+
+/* Copie la case i de source dans la case j de *pdestination (même mode de rangement) */
+static void TH_copierCase(TH_TableHachage* pdestination, unsigned int j, const TH_TableHachage* psource, unsigned int i) {
+  if (psource->enLigne) {
+    memcpy(TH_caseEnLigne(pdestination, j), TH_caseEnLigne(psource, i), psource->tailleCase);
+  } else {
+    pdestination->cases[j] = psource->cases[i];
   }
-  pDst->pcle = g_copierCle(pSrc->pcle);
-  pDst->pvaleur = g_copierValeur(pSrc->pvaleur);
-  return (void*)pDst;
 }
 
-static void TH_libererCleValeurProfondeur(void* pcleValeur) {
-  TH_CleValeur* p;
-  p = (TH_CleValeur*)pcleValeur;
-  if (p != NULL) {
-    if (g_libererCle != NULL && p->pcle != NULL) {
-      g_libererCle(p->pcle);
+static void TH_marquerCaseVide(TH_TableHachage* ptableHachage, unsigned int i) {
+  if (ptableHachage->enLigne) {
+    memset(TH_caseEnLigne(ptableHachage, i) + ptableHachage->decalageHache, 0, sizeof(uint32_t));
+  } else {
+    ptableHachage->cases[i].pcle = NULL;
+    ptableHachage->cases[i].pvaleur = NULL;
+  }
+}
+
+/* Indice de la case qui contient la clé, ou de la case vide où la ranger.
+   La table doit avoir au moins une case vide. */
+static unsigned int TH_rechercherCase(const TH_TableHachage* ptableHachage, void* pcle, size_t hache) {
+  unsigned int masque;
+  unsigned int i;
+
+  masque = ptableHachage->capacite - 1U;
+  i = (unsigned int)hache & masque;
+  while (TH_caseOccupee(ptableHachage, i)) {
+    if (TH_hacheCase(ptableHachage, i) == hache) {
+      if (ptableHachage->enLigne) {
+        if (memcmp(TH_caseEnLigne(ptableHachage, i), pcle, ptableHachage->tailleCle) == 0) {
+          break;
+        }
+      } else if (ptableHachage->comparerCle(pcle, ptableHachage->cases[i].pcle) == 0) {
+        break;
+      }
     }
-    if (g_libererValeur != NULL && p->pvaleur != NULL) {
-      g_libererValeur(p->pvaleur);
+    i = (i + 1U) & masque;
+  }
+  return i;
+}
+
+/* Cherche la case occupée par la clé : faux si elle est absente */
+static bool TH_trouverCase(const TH_TableHachage* ptableHachage, void* pcle, unsigned int* pi) {
+  if (ptableHachage->nbElements == 0U) {
+    return false;
+  }
+  *pi = TH_rechercherCase(ptableHachage, pcle, TH_hash(ptableHachage, pcle));
+  return TH_caseOccupee(ptableHachage, *pi);
+}
+
+/* Range toutes les cases dans un nouveau tableau de nouvelleCapacite cases (puissance de 2) */
+static bool TH_redimensionner(TH_TableHachage* ptableHachage, unsigned int nouvelleCapacite) {
+  TH_TableHachage ancienne;
+  void* nouvelles;
+  unsigned int i;
+  unsigned int j;
+
+  nouvelles = calloc(nouvelleCapacite, ptableHachage->enLigne ? ptableHachage->tailleCase : sizeof(TH_Case));
+  if (nouvelles == NULL) {
+    return false;
+  }
+  ancienne = *ptableHachage;
+  ptableHachage->cases = ptableHachage->enLigne ? NULL : (TH_Case*)nouvelles;
+  ptableHachage->donnees = ptableHachage->enLigne ? (unsigned char*)nouvelles : NULL;
+  ptableHachage->capacite = nouvelleCapacite;
+  for (i = 0U; i < ancienne.capacite; ++i) {
+    if (TH_caseOccupee(&ancienne, i)) {
+      j = (unsigned int)TH_hacheCase(&ancienne, i) & (nouvelleCapacite - 1U);
+      while (TH_caseOccupee(ptableHachage, j)) {
+        j = (j + 1U) & (nouvelleCapacite - 1U);
+      }
+      TH_copierCase(ptableHachage, j, &ancienne, i);
     }
-    free(p);
-  }
-}
-
-static LC_ListeChainee TH_rechercherCleDansListe(LC_ListeChainee l,
-						 void* pcle,
-						 CLC_FonctionComparer comparerCle) {
-  TH_CleValeur* pclevaleur;
-  LC_ListeChainee listeSuivante;;
-  if (!LC_estVide(l)) {
-    pclevaleur = (TH_CleValeur*)LC_obtenirElement(l);
-    if (comparerCle(pcle, pclevaleur->pcle) == 0) {
-      return l;
-    } else {
-      listeSuivante = LC_obtenirListeSuivante(l);
-      return TH_rechercherCleDansListe(listeSuivante, pcle, comparerCle);
+  }
+  free(ancienne.cases);
+  free(ancienne.donnees);
+  return true;
+}
+
+/* Libère la clé et la valeur d'une case occupée (la case n'est pas vidée) */
+static void TH_libererCase(const TH_TableHachage* ptableHachage, unsigned int i) {
+  if (ptableHachage->enLigne) {
+    return;
+  }
+  if (ptableHachage->libererCle != NULL) {
+    ptableHachage->libererCle(ptableHachage->cases[i].pcle);
+  }
+  if (ptableHachage->libererValeur != NULL && ptableHachage->cases[i].pvaleur != NULL) {
+    ptableHachage->libererValeur(ptableHachage->cases[i].pvaleur);
+  }
+}
+
+/* Vide la case i puis recule les cases suivantes du même groupe qui peuvent l'être,
+   pour qu'aucune recherche ne s'arrête sur un trou (pas de marque de suppression) */
+static void TH_retirerCase(TH_TableHachage* ptableHachage, unsigned int i) {
+  unsigned int masque;
+  unsigned int j;
+  unsigned int ideal;
+
+  masque = ptableHachage->capacite - 1U;
+  j = i;
+  for (;;) {
+    j = (j + 1U) & masque;
+    if (!TH_caseOccupee(ptableHachage, j)) {
+      break;
     }
-  } else
-    return l;
-}
-
-static void TH_supprimerCleValeurDeLaListe(LC_ListeChainee* pl,
-					   void* pcle,
-					   CLC_FonctionComparer comparerCle) {
-  TH_CleValeur* pclevaleur;
-  LC_ListeChainee listeSuivante;;
-  if (!LC_estVide(*pl)) {
-    pclevaleur = (TH_CleValeur*)LC_obtenirElement(*pl);
-    if (comparerCle(pcle, pclevaleur->pcle) == 0) {
-      LC_supprimerTete(pl, TH_libererCleValeurProfondeur);
-    } else {
-      listeSuivante = LC_obtenirListeSuivante(*pl);
-      TH_supprimerCleValeurDeLaListe(&listeSuivante, pcle, comparerCle);
-      LC_fixerListeSuivante(pl, listeSuivante);
+    ideal = (unsigned int)TH_hacheCase(ptableHachage, j) & masque;
+    /* la case j peut venir en i si sa position idéale n'est pas dans ]i, j] (circulairement) */
+    if (((j - ideal) & masque) >= ((j - i) & masque)) {
+      TH_copierCase(ptableHachage, i, ptableHachage, j);
+      i = j;
     }
-  } else
-    errno = TH_CLE_ABSENTE_ERREUR;
+  }
+  TH_marquerCaseVide(ptableHachage, i);
 }
 
+/* Première étape commune des insertions : agrandit la table si besoin, puis donne dans *pi la case
+   qui contient la clé ou la case vide où la ranger, et dans *phache le haché de la clé.
+   En ligne, l'insertion y est terminée : la clé est rangée si la case était vide, puis la valeur.
+   Faux (errno=TH_MEMOIRE_ERREUR, table inchangée) si la table n'a pas pu grandir. */
+static bool TH_reclamerCase(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur, unsigned int* pi, size_t* phache) {
+  uint32_t hacheEnLigne;
+  unsigned int i;
+
+  if ((double)(ptableHachage->nbElements + 1U) > TH_TAUX_REMPLISSAGE_MAX * ptableHachage->capacite) {
+    if (!TH_redimensionner(ptableHachage, (ptableHachage->capacite == 0U) ? TH_CAPACITE_INITIALE : 2U * ptableHachage->capacite)) {
+      errno = TH_MEMOIRE_ERREUR;
+      return false;
+    }
+  }
+  *phache = TH_hash(ptableHachage, pcle);
+  i = TH_rechercherCase(ptableHachage, pcle, *phache);
+  if (ptableHachage->enLigne) {
+    if (!TH_caseOccupee(ptableHachage, i)) {
+      memcpy(TH_caseEnLigne(ptableHachage, i), pcle, ptableHachage->tailleCle);
+      hacheEnLigne = (uint32_t)*phache;
+      memcpy(TH_caseEnLigne(ptableHachage, i) + ptableHachage->decalageHache, &hacheEnLigne, sizeof(uint32_t));
+      ptableHachage->nbElements += 1U;
+    }
+    if (ptableHachage->tailleValeur > 0U) {
+      memcpy(TH_valeurCase(ptableHachage, i), pvaleur, ptableHachage->tailleValeur);
+    }
+  }
+  *pi = i;
+  return true;
+}
+
+/* Libère les clés et les valeurs de toutes les cases occupées (le tableau des cases est conservé) */
+static void TH_libererElements(TH_TableHachage* ptableHachage) {
+  unsigned int i;
+
+  if (ptableHachage->enLigne || ptableHachage->nbElements == 0U) {
+    return;
+  }
+  for (i = 0U; i < ptableHachage->capacite; ++i) {
+    if (ptableHachage->cases[i].pcle != NULL) {
+      TH_libererCase(ptableHachage, i);
+    }
+  }
+}
 
 /* -------------------------------------------------------------------------- */
 /*                    FONCTIONS PUBLIQUES DU MODULE                           */
@@ -107,21 +250,55 @@ TH_TableHachage TH_tableHachage(CLC_FonctionCopier copierCle,
                                 CLC_FonctionComparer comparerCle,
                                 size_t tailleCle,
                                 CLC_FonctionCopier copierValeur,
-                                CLC_FonctionLiberer libererValeur) {
+                                CLC_FonctionLiberer libererValeur,
+                                TH_FonctionHachage hacher) {
   TH_TableHachage tableHachage;
-  unsigned int i;
 
+  tableHachage.cases = NULL;
+  tableHachage.capacite = 0U;
   tableHachage.tailleCle = tailleCle;
   tableHachage.copierCle = copierCle;
   tableHachage.libererCle = libererCle;
   tableHachage.comparerCle = comparerCle;
   tableHachage.copierValeur = copierValeur;
   tableHachage.libererValeur = libererValeur;
+  tableHachage.hacher = (hacher != NULL) ? hacher : TH_hacherOctets;
+  tableHachage.enLigne = false;
+  tableHachage.tailleValeur = 0U;
+  tableHachage.tailleCase = sizeof(TH_Case);
+  tableHachage.decalageValeur = 0U;
+  tableHachage.decalageHache = 0U;
+  tableHachage.donnees = NULL;
   tableHachage.nbElements = 0U;
 
-  for (i = 0U; i < (unsigned int)TH_TAILLE_TABLE; ++i) {
-    tableHachage.table[i] = LC_listeChainee();
+  return tableHachage;
+}
+
+TH_TableHachage TH_tableHachageEnLigne(CLC_FonctionCopier copierCle,
+                                       CLC_FonctionLiberer libererCle,
+                                       size_t tailleCle,
+                                       CLC_FonctionCopier copierValeur,
+                                       CLC_FonctionLiberer libererValeur,
+                                       size_t tailleValeur,
+                                       TH_FonctionHachage hacher) {
+  TH_TableHachage tableHachage;
+  size_t alignement;
+
+  tableHachage = TH_tableHachage(copierCle, libererCle, NULL, tailleCle,
+                                 copierValeur, libererValeur, hacher);
+  tableHachage.enLigne = true;
+  tableHachage.tailleValeur = tailleValeur;
+  /* case : clé, valeur puis haché sur 32 bits, chacun aligné selon sa taille */
+  tableHachage.decalageValeur = TH_arrondir(tailleCle, TH_alignement(tailleValeur));
+  tableHachage.decalageHache = TH_arrondir(tableHachage.decalageValeur + tailleValeur, sizeof(uint32_t));
+  alignement = TH_alignement(tailleCle);
+  if (TH_alignement(tailleValeur) > alignement) {
+    alignement = TH_alignement(tailleValeur);
+  }
+  if (sizeof(uint32_t) > alignement) {
+    alignement = sizeof(uint32_t);
   }
+  tableHachage.tailleCase = TH_arrondir(tableHachage.decalageHache + sizeof(uint32_t), alignement);
 
   return tableHachage;
 }
@@ -135,66 +312,134 @@ unsigned int TH_taille(TH_TableHachage tableHachage) {
 }
 
 bool TH_contient(TH_TableHachage tableHachage, void* pcle) {
-  unsigned char idx;
+  return TH_contientRef(&tableHachage, pcle);
+}
 
-  idx = TH_hash(pcle, tableHachage.tailleCle);
-  return TH_rechercherCleDansListe(tableHachage.table[(unsigned int)idx], pcle, tableHachage.comparerCle) != NULL;
+bool TH_contientRef(const TH_TableHachage* ptableHachage, void* pcle) {
+  unsigned int i;
+
+  return TH_trouverCase(ptableHachage, pcle, &i);
 }
 
 void TH_inserer(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur) {
-  unsigned char idx;
-  LC_ListeChainee l;
-  TH_CleValeur* pclevaleur;
-  TH_CleValeur tmp;
+  size_t hache;
+  unsigned int i;
+  TH_Case* pcase;
+  void* pNewCle;
   void* pNewVal;
 
-  idx = TH_hash(pcle, ptableHachage->tailleCle);
-  l = TH_rechercherCleDansListe(ptableHachage->table[(unsigned int)idx], pcle, ptableHachage->comparerCle);
-  if (LC_estVide(l)) {
-    g_copierCle = ptableHachage->copierCle;
-    g_copierValeur = ptableHachage->copierValeur;
-    tmp.pcle = pcle;
-    tmp.pvaleur = pvaleur;
-    LC_ajouter(&(ptableHachage->table[(unsigned int)idx]), (void*)&tmp, TH_copierCleValeurProfondeur);
-    ptableHachage->nbElements += 1U;
-  } else {
-    pclevaleur = (TH_CleValeur*)LC_obtenirElement(l);
-    pNewVal = ptableHachage->copierValeur(pvaleur);
-    if (pNewVal == NULL) {
+  if (!TH_reclamerCase(ptableHachage, pcle, pvaleur, &i, &hache)) {
+    return;
+  }
+  if (ptableHachage->enLigne) {
+    /* rangement par valeur : ni copie ni allocation */
+    errno = 0;
+    return;
+  }
+  pcase = &(ptableHachage->cases[i]);
+  pNewVal = ptableHachage->copierValeur(pvaleur);
+  if (pNewVal == NULL) {
+    errno = TH_MEMOIRE_ERREUR;
+    return;
+  }
+  if (pcase->pcle == NULL) {
+    pNewCle = ptableHachage->copierCle(pcle);
+    if (pNewCle == NULL) {
+      ptableHachage->libererValeur(pNewVal);
       errno = TH_MEMOIRE_ERREUR;
       return;
     }
-    ptableHachage->libererValeur(pclevaleur->pvaleur);
-    pclevaleur->pvaleur = pNewVal;
+    pcase->pcle = pNewCle;
+    pcase->hache = hache;
+    ptableHachage->nbElements += 1U;
+  } else {
+    ptableHachage->libererValeur(pcase->pvaleur);
   }
+  pcase->pvaleur = pNewVal;
   errno = 0;
 }
 
+void TH_insererPrendre(TH_TableHachage* ptableHachage, void* pcle, void* pvaleur) {
+  size_t hache;
+  unsigned int i;
+  TH_Case* pcase;
+
+  if (!TH_reclamerCase(ptableHachage, pcle, pvaleur, &i, &hache)) {
+    return;
+  }
+  if (ptableHachage->enLigne) {
+    /* les octets sont rangés dans la case, les blocs reçus ne servent plus */
+    if (ptableHachage->tailleValeur > 0U && ptableHachage->libererValeur != NULL) {
+      ptableHachage->libererValeur(pvaleur);
+    }
+    if (ptableHachage->libererCle != NULL) {
+      ptableHachage->libererCle(pcle);
+    }
+    errno = 0;
+    return;
+  }
+  pcase = &(ptableHachage->cases[i]);
+  if (pcase->pcle == NULL) {
+    pcase->pcle = pcle;
+    pcase->hache = hache;
+    ptableHachage->nbElements += 1U;
+  } else {
+    /* la table garde sa clé, égale à celle reçue */
+    ptableHachage->libererCle(pcle);
+    ptableHachage->libererValeur(pcase->pvaleur);
+  }
+  pcase->pvaleur = pvaleur;
+  errno = 0;
+}
 
 void TH_supprimer(TH_TableHachage* ptableHachage, void* pcle) {
-  unsigned char idx;
+  unsigned int i;
 
-  idx = TH_hash(pcle, ptableHachage->tailleCle);
-  g_libererCle = ptableHachage->libererCle;
-  g_libererValeur = ptableHachage->libererValeur;
+  if (!TH_trouverCase(ptableHachage, pcle, &i)) {
+    errno = TH_CLE_ABSENTE_ERREUR;
+    return;
+  }
+  TH_libererCase(ptableHachage, i);
+  TH_retirerCase(ptableHachage, i);
+  ptableHachage->nbElements -= 1U;
   errno = 0;
-  TH_supprimerCleValeurDeLaListe(&(ptableHachage->table[(unsigned int)idx]), pcle, ptableHachage->comparerCle);
-  if (errno == 0) {
-      ptableHachage->nbElements -= 1U;
+}
+
+void* TH_supprimerPrendre(TH_TableHachage* ptableHachage, void* pcle) {
+  unsigned int i;
+  void* pvaleur;
+
+  if (!TH_trouverCase(ptableHachage, pcle, &i)) {
+    errno = TH_CLE_ABSENTE_ERREUR;
+    return NULL;
   }
+  if (ptableHachage->enLigne) {
+    /* la valeur n'existe que dans la case : elle ne peut être rendue que copiée */
+    pvaleur = ptableHachage->copierValeur(TH_valeurCase(ptableHachage, i));
+    if (pvaleur == NULL) {
+      errno = TH_MEMOIRE_ERREUR;
+      return NULL;
+    }
+  } else {
+    pvaleur = ptableHachage->cases[i].pvaleur;
+    ptableHachage->libererCle(ptableHachage->cases[i].pcle);
+  }
+  TH_retirerCase(ptableHachage, i);
+  ptableHachage->nbElements -= 1U;
+  errno = 0;
+  return pvaleur;
 }
 
 void* TH_valeur(TH_TableHachage tableHachage, void* pcle) {
-  unsigned char idx;
-  LC_ListeChainee l;
-  TH_CleValeur* pclevaleur;
+  return TH_valeurRef(&tableHachage, pcle);
+}
+
+void* TH_valeurRef(const TH_TableHachage* ptableHachage, void* pcle) {
+  unsigned int i;
   void* pCopie;
 
-  idx = TH_hash(pcle, tableHachage.tailleCle);
-  l = TH_rechercherCleDansListe(tableHachage.table[(unsigned int)idx], pcle, tableHachage.comparerCle);
-  if (!LC_estVide(l)) {
-    pclevaleur = (TH_CleValeur*)LC_obtenirElement(l);
-    pCopie = tableHachage.copierValeur(pclevaleur->pvaleur);
+  if (TH_trouverCase(ptableHachage, pcle, &i)) {
+    pCopie = ptableHachage->copierValeur(TH_valeurCase(ptableHachage, i));
     if (pCopie == NULL) {
       errno = TH_MEMOIRE_ERREUR;
       return NULL;
@@ -206,21 +451,44 @@ void* TH_valeur(TH_TableHachage tableHachage, void* pcle) {
   return NULL;
 }
 
+const void* TH_valeurEmpruntee(TH_TableHachage tableHachage, void* pcle) {
+  return TH_valeurEmprunteeRef(&tableHachage, pcle);
+}
+
+const void* TH_valeurEmprunteeRef(const TH_TableHachage* ptableHachage, void* pcle) {
+  unsigned int i;
+
+  if (!TH_trouverCase(ptableHachage, pcle, &i)) {
+    errno = TH_CLE_ABSENTE_ERREUR;
+    return NULL;
+  }
+  errno = 0;
+  return TH_valeurCase(ptableHachage, i);
+}
+
+void* TH_referenceValeur(TH_TableHachage* ptableHachage, void* pcle) {
+  unsigned int i;
+
+  if (!TH_trouverCase(ptableHachage, pcle, &i)) {
+    errno = TH_CLE_ABSENTE_ERREUR;
+    return NULL;
+  }
+  errno = 0;
+  return TH_valeurCase(ptableHachage, i);
+}
+
 void** TH_cles(TH_TableHachage tableHachage) {
-  void** pTab = (void**)malloc(tableHachage.nbElements * sizeof(void*));
+  void** pTab = (void**)malloc((tableHachage.nbElements > 0U ? tableHachage.nbElements : 1U) * sizeof(void*));
   unsigned int i;
   unsigned int j;
-  TH_CleValeur* pclevaleur;
   if (pTab == NULL) {
     errno = TH_MEMOIRE_ERREUR;
     return NULL;
   }
   j = 0U;
-  for (i = 0U; i < (unsigned int)TH_TAILLE_TABLE; ++i) {
-    LC_ListeChainee l = tableHachage.table[i];
-    while (!LC_estVide(l)) {
-      pclevaleur = (TH_CleValeur*)LC_obtenirElement(l);
-      pTab[j] = tableHachage.copierCle(pclevaleur->pcle);
+  for (i = 0U; i < tableHachage.capacite; ++i) {
+    if (TH_caseOccupee(&tableHachage, i)) {
+      pTab[j] = tableHachage.copierCle(TH_cleCase(&tableHachage, i));
       if (pTab[j] == NULL) {
 	unsigned int k;
 	for (k = 0U; k < j; ++k) {
@@ -231,26 +499,166 @@ void** TH_cles(TH_TableHachage tableHachage) {
 	return NULL;
       }
       j += 1U;
-      l = LC_obtenirListeSuivante(l);
     }
   }
   errno = 0;
   return pTab;
 }
 
+TH_Iterateur TH_iterateur(const TH_TableHachage* ptableHachage) {
+  TH_Iterateur it;
 
-void TH_vider(TH_TableHachage* ptableHachage) {
+  it.ptableHachage = ptableHachage;
+  it.prochaineCase = 0U;
+  return it;
+}
+
+bool TH_suivant(TH_Iterateur* pit, const void** ppcle, const void** ppvaleur) {
+  unsigned int i;
+
+  for (i = pit->prochaineCase; i < pit->ptableHachage->capacite; ++i) {
+    if (TH_caseOccupee(pit->ptableHachage, i)) {
+      if (ppcle != NULL) {
+        *ppcle = TH_cleCase(pit->ptableHachage, i);
+      }
+      if (ppvaleur != NULL) {
+        *ppvaleur = TH_valeurCase(pit->ptableHachage, i);
+      }
+      pit->prochaineCase = i + 1U;
+      return true;
+    }
+  }
+  pit->prochaineCase = i;
+  return false;
+}
+
+TH_Statistiques TH_statistiques(const TH_TableHachage* ptableHachage) {
+  TH_Statistiques stats;
+  unsigned int masque;
+  unsigned int distance;
+  unsigned long long sommeDistances;
   unsigned int i;
 
-  for (i = 0U; i < (unsigned int)TH_TAILLE_TABLE; ++i) {
-    while (!LC_estVide(ptableHachage->table[i])) {
-      g_libererCle = ptableHachage->libererCle;
-      g_libererValeur = ptableHachage->libererValeur;
-      LC_supprimerTete(&(ptableHachage->table[i]), TH_libererCleValeurProfondeur);
-      if (ptableHachage->nbElements > 0U) {
-        ptableHachage->nbElements -= 1U;
+  memset(&stats, 0, sizeof(TH_Statistiques));
+  stats.nbElements = ptableHachage->nbElements;
+  stats.capacite = ptableHachage->capacite;
+  stats.octetsUtilises = (size_t)ptableHachage->capacite * ptableHachage->tailleCase;
+  if (!ptableHachage->enLigne) {
+    stats.octetsUtilises += (size_t)ptableHachage->nbElements * ptableHachage->tailleCle;
+  }
+  if (ptableHachage->capacite == 0U) {
+    return stats;
+  }
+  stats.tauxRemplissage = (double)ptableHachage->nbElements / ptableHachage->capacite;
+  masque = ptableHachage->capacite - 1U;
+  sommeDistances = 0U;
+  for (i = 0U; i < ptableHachage->capacite; ++i) {
+    if (TH_caseOccupee(ptableHachage, i)) {
+      distance = (i - ((unsigned int)TH_hacheCase(ptableHachage, i) & masque)) & masque;
+      sommeDistances += distance;
+      if (distance > stats.sondageMax) {
+        stats.sondageMax = distance;
       }
+      stats.histogramme[(distance < TH_TAILLE_HISTOGRAMME - 1) ? distance : TH_TAILLE_HISTOGRAMME - 1] += 1U;
+    }
+  }
+  if (ptableHachage->nbElements > 0U) {
+    stats.sondageMoyen = (double)sommeDistances / ptableHachage->nbElements;
+  }
+  return stats;
+}
+
+void TH_afficherStatistiques(TH_Statistiques stats, FILE* flux) {
+  unsigned int i;
+
+  fprintf(flux, "TH: %u elements, capacite %u, remplissage %.2f, sondage moyen %.2f, max %u, %zu octets, histogramme",
+          stats.nbElements, stats.capacite, stats.tauxRemplissage, stats.sondageMoyen, stats.sondageMax,
+          stats.octetsUtilises);
+  for (i = 0U; i < TH_TAILLE_HISTOGRAMME; ++i) {
+    fprintf(flux, " %u", stats.histogramme[i]);
+  }
+  fprintf(flux, "\n");
+}
+
+void TH_reserver(TH_TableHachage* ptableHachage, unsigned int n) {
+  unsigned int capacite;
+
+  capacite = (ptableHachage->capacite == 0U) ? TH_CAPACITE_INITIALE : ptableHachage->capacite;
+  while ((double)n > TH_TAUX_REMPLISSAGE_MAX * capacite) {
+    if (capacite > UINT_MAX / 2U) {
+      /* la capacité suivante ne tiendrait plus dans un unsigned int */
+      errno = TH_MEMOIRE_ERREUR;
+      return;
     }
+    capacite *= 2U;
+  }
+  if (capacite > ptableHachage->capacite && !TH_redimensionner(ptableHachage, capacite)) {
+    errno = TH_MEMOIRE_ERREUR;
+    return;
+  }
+  errno = 0;
+}
+
+void TH_reinitialiser(TH_TableHachage* ptableHachage) {
+  TH_libererElements(ptableHachage);
+  if (ptableHachage->enLigne && ptableHachage->capacite > 0U) {
+    /* un haché nul marque une case vide */
+    memset(ptableHachage->donnees, 0, (size_t)ptableHachage->capacite * ptableHachage->tailleCase);
+  } else if (ptableHachage->capacite > 0U) {
+    memset(ptableHachage->cases, 0, (size_t)ptableHachage->capacite * sizeof(TH_Case));
+  }
+  ptableHachage->nbElements = 0U;
+  errno = 0;
+}
+
+void TH_vider(TH_TableHachage* ptableHachage) {
+#ifdef TH_STATISTIQUES
+  if (ptableHachage->nbElements > 0U) {
+    TH_afficherStatistiques(TH_statistiques(ptableHachage), stderr);
   }
+#endif
+
+  TH_libererElements(ptableHachage);
+  free(ptableHachage->cases);
+  free(ptableHachage->donnees);
+  ptableHachage->cases = NULL;
+  ptableHachage->donnees = NULL;
+  ptableHachage->capacite = 0U;
+  ptableHachage->nbElements = 0U;
   errno = 0;
 }
+
+uint64_t TH_melanger(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+size_t TH_hacherOctets(void* pcle, size_t tailleCle) {
+  const unsigned char* p;
+  uint64_t h;
+  uint64_t bloc;
+  size_t reste;
+
+  p = (const unsigned char*)pcle;
+  h = (uint64_t)tailleCle * TH_MULTIPLICATEUR;
+  for (reste = tailleCle; reste >= sizeof(uint64_t); reste -= sizeof(uint64_t)) {
+    memcpy(&bloc, p, sizeof(uint64_t));
+    h = (h ^ TH_melanger(bloc)) * TH_MULTIPLICATEUR;
+    p += sizeof(uint64_t);
+  }
+  if (reste > 0U) {
+    bloc = 0U;
+    memcpy(&bloc, p, reste);
+    h = (h ^ TH_melanger(bloc)) * TH_MULTIPLICATEUR;
+  }
+  return (size_t)TH_melanger(h);
+}
+
+size_t TH_hacherEntier(void* pcle, size_t tailleCle) {
+  (void)tailleCle;
+  return (size_t)TH_melanger((uint64_t)(unsigned int)*(int*)pcle);
+}
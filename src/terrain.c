@@ -1,6 +1,104 @@
 #include "terrain.h"
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief (Ré)initialise l'union-find des composantes : chaque case est seule dans sa composante
+ * @param t Pointeur vers le terrain
+ * @param h Taille du terrain
+ */
+static void T_initialiserComposantes(T_Terrain* t, unsigned int h) {
+    free(t->composantes);
+    free(t->rangsComposantes);
+    size_t nbCases = (size_t)h * h + 1;
+    t->composantes = malloc(nbCases * sizeof(unsigned int));
+    t->rangsComposantes = calloc(nbCases, sizeof(unsigned char));
+    if (t->composantes == NULL || t->rangsComposantes == NULL) {
+        free(t->composantes);
+        free(t->rangsComposantes);
+        t->composantes = NULL;
+        t->rangsComposantes = NULL;
+        return;
+    }
+    for (size_t i = 0; i < nbCases; i++) {
+        t->composantes[i] = (unsigned int)i;
+    }
+}
+
+/**
+ * @brief Représentant de la composante d'une case, sans modifier l'union-find
+ * @param composantes L'union-find
+ * @param numCase Numéro de la case
+ * @return Le numéro de la case représentante
+ */
+static unsigned int T_representant(const unsigned int* composantes, unsigned int numCase) {
+    while (composantes[numCase] != numCase) {
+        numCase = composantes[numCase];
+    }
+    return numCase;
+}
+
+static bool T_estDansLeTerrain(const T_Terrain* t, CO_Coordonnee c) {
+    return CO_abscisse(c) < t->taille && CO_ordonnee(c) < t->taille;
+}
+
+/**
+ * @brief Fusionne les composantes de deux cases (union par rang, chemins divisés par deux)
+ * @param t Pointeur vers le terrain (non figé)
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ */
+static void T_unirCases(T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b) {
+    // Les ajouts de chemins refusent les cases hors du terrain avant d'atteindre le graphe
+    assert(T_estDansLeTerrain(t, a) && T_estDansLeTerrain(t, b));
+    if (t->rangsComposantes == NULL) {
+        return;
+    }
+    unsigned int representants[2] = {CO_CoordonneeVersNumeroCase(a, t->taille), CO_CoordonneeVersNumeroCase(b, t->taille)};
+    for (int i = 0; i < 2; i++) {
+        unsigned int c = representants[i];
+        while (t->composantes[c] != c) {
+            t->composantes[c] = t->composantes[t->composantes[c]];
+            c = t->composantes[c];
+        }
+        representants[i] = c;
+    }
+    unsigned int ra = representants[0], rb = representants[1];
+    if (ra == rb) {
+        return;
+    }
+    if (t->rangsComposantes[ra] < t->rangsComposantes[rb]) {
+        t->composantes[ra] = rb;
+    } else {
+        t->composantes[rb] = ra;
+        if (t->rangsComposantes[ra] == t->rangsComposantes[rb]) {
+            t->rangsComposantes[ra]++;
+        }
+    }
+}
+
+/**
+ * @brief Aplatit l'union-find (chaque case pointe sur son représentant) et libère les rangs, qui ne servent plus
+ * @param t Pointeur vers le terrain qui vient d'être figé
+ */
+static void T_aplatirComposantes(T_Terrain* t) {
+    if (t->composantes == NULL) {
+        return;
+    }
+    size_t nbCases = (size_t)t->taille * t->taille + 1;
+    for (size_t i = 0; i < nbCases; i++) {
+        t->composantes[i] = T_representant(t->composantes, (unsigned int)i);
+    }
+    free(t->rangsComposantes);
+    t->rangsComposantes = NULL;
+}
 
 /**
  * @brief Crée un terrain vide de taille h x h
@@ -11,12 +109,30 @@ T_Terrain T_terrain(unsigned int h) {
     T_Terrain t;
     t.taille = h;
     
-    // Création d'un graphe non-orienté, non-étiqueté, non-valué
-    t.chemins = G_graphe(false, NULL, NULL, NULL, NULL, NULL, NULL);
+    // Création d'un graphe dense non-orienté, non-étiqueté, non-valué
+    // (ids 0..h*h, l'id 0 n'étant pas une case)
+    t.chemins = G_grapheDense(false, h * h + 1, NULL, NULL, NULL, NULL, NULL, NULL);
+    t.estFige = false;
+    t.cheminsFiges.oriente = false;
+    t.cheminsFiges.nbIds = 0;
+    t.cheminsFiges.nbEntrees = 0;
+    t.cheminsFiges.debuts = NULL;
+    t.cheminsFiges.voisins = NULL;
+    t.cheminsFiges.poids = NULL;
+    t.cheminsFiges.zone = NULL;
+    t.cheminsFiges.tailleZone = 0;
+    t.coutMinimal = 1.0f;
+    t.estGrille = false;
+    t.ouvertures = NULL;
+    t.zone = NULL;
+    t.tailleZone = 0;
+    t.composantes = NULL;
+    t.rangsComposantes = NULL;
+    T_initialiserComposantes(&t, h);
     
     // Ajout de tous les sommets (cases du terrain)
-    // Les cases sont numérotées de 0 à h*h - 1
-    for (unsigned int i = 0; i < h * h; i++) {
+    // Les cases sont numérotées de 1 à h*h (voir CO_CoordonneeVersNumeroCase)
+    for (unsigned int i = 1; i <= h * h; i++) {
         G_ajouterSommet(&t.chemins, i, NULL);
     }
     
@@ -25,11 +141,80 @@ T_Terrain T_terrain(unsigned int h) {
     t.directionDepart = N;
     
     // Création de l'ensemble des objectifs (vide initialement)
-    t.positionsObjectifs = THE_ensemble(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee));
+    t.positionsObjectifs = THE_ensemble(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee), CO_hacher);
     
     return t;
 }
 
+/**
+ * @brief Crée un terrain vide de taille h x h stocké en grille de bits
+ * @param h Taille du terrain
+ * @return Le terrain initialisé
+ */
+T_Terrain T_terrainGrille(unsigned int h) {
+    // Le graphe des chemins reste vide (non dense : aucune allocation par case)
+    T_Terrain t = T_terrain(0);
+    t.estGrille = true;
+    t.ouvertures = calloc((2 * (size_t)h * h + 7) / 8 + 1, sizeof(unsigned char));
+    if (t.ouvertures == NULL) {
+        errno = G_MEMOIRE_ERREUR;
+        return t;
+    }
+    t.taille = h;
+    T_initialiserComposantes(&t, h);
+    return t;
+}
+
+#define T_VERS_LA_DROITE 0
+#define T_VERS_LE_BAS 1
+
+/**
+ * @brief Position, dans les ouvertures d'une grille, du bit du passage entre a et b
+ * @param t Le terrain (grille)
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ * @param pbit Reçoit la position du bit
+ * @return false si a et b ne sont pas des cases adjacentes du terrain
+ */
+static bool T_bitDuPassage(const T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b, size_t* pbit) {
+    unsigned int xa = CO_abscisse(a), ya = CO_ordonnee(a);
+    unsigned int xb = CO_abscisse(b), yb = CO_ordonnee(b);
+    if (xa >= t->taille || ya >= t->taille || xb >= t->taille || yb >= t->taille) {
+        return false;
+    }
+    // Le passage est porté par la case de gauche (ou du haut)
+    if (ya == yb && (xa + 1 == xb || xb + 1 == xa)) {
+        *pbit = 2 * ((size_t)ya * t->taille + (xa < xb ? xa : xb)) + T_VERS_LA_DROITE;
+        return true;
+    }
+    if (xa == xb && (ya + 1 == yb || yb + 1 == ya)) {
+        *pbit = 2 * ((size_t)(ya < yb ? ya : yb) * t->taille + xa) + T_VERS_LE_BAS;
+        return true;
+    }
+    return false;
+}
+
+static bool T_estOuvert(const unsigned char* ouvertures, size_t bit) {
+    return (ouvertures[bit / 8] >> (bit % 8)) & 1U;
+}
+
+/**
+ * @brief Ouvre le passage entre deux cases adjacentes d'une grille
+ * @param t Pointeur vers le terrain (grille)
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ */
+static void T_ouvrirPassage(T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b) {
+    size_t bit;
+    if (!T_bitDuPassage(t, a, b, &bit)) {
+        errno = T_TERRAIN_GRILLE_ERREUR;
+        return;
+    }
+    t->ouvertures[bit / 8] |= (unsigned char)(1U << (bit % 8));
+    T_unirCases(t, a, b);
+    errno = 0;
+}
+
 /**
  * @brief Vérifie si un chemin existe entre deux coordonnées adjacentes
  * @param t Le terrain
@@ -38,9 +223,56 @@ T_Terrain T_terrain(unsigned int h) {
  * @return true si un chemin existe, false sinon
  */
 bool T_cheminExiste(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b) {
-    unsigned int caseA = CO_CoordonneeVersNumeroCase(a, t.taille);
-    unsigned int caseB = CO_CoordonneeVersNumeroCase(b, t.taille);
-    return G_arcPresent(t.chemins, caseA, caseB);
+    return T_cheminExisteRef(&t, a, b);
+}
+
+/**
+ * @brief Vérifie si un chemin existe entre deux coordonnées adjacentes, sans copier le terrain
+ * @param t Pointeur vers le terrain
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ * @return true si un chemin existe, false sinon
+ */
+bool T_cheminExisteRef(const T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b) {
+    if (t->estGrille) {
+        size_t bit;
+        return T_bitDuPassage(t, a, b, &bit) && T_estOuvert(t->ouvertures, bit);
+    }
+    unsigned int caseA = CO_CoordonneeVersNumeroCase(a, t->taille);
+    unsigned int caseB = CO_CoordonneeVersNumeroCase(b, t->taille);
+    if (t->estFige) {
+        return G_figeArcPresent(&t->cheminsFiges, caseA, caseB);
+    }
+    return G_arcPresentRef(&t->chemins, caseA, caseB);
+}
+
+/**
+ * @brief Vérifie si deux coordonnées sont dans la même composante connexe
+ * @param t Le terrain
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ * @return false si aucun trajet ne les relie
+ */
+bool T_sontConnectees(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b) {
+    return T_sontConnecteesRef(&t, a, b);
+}
+
+/**
+ * @brief Vérifie si deux coordonnées sont dans la même composante connexe, sans copier le terrain
+ * @param t Pointeur vers le terrain
+ * @param a Première coordonnée
+ * @param b Deuxième coordonnée
+ * @return false si aucun trajet ne les relie
+ */
+bool T_sontConnecteesRef(const T_Terrain* t, CO_Coordonnee a, CO_Coordonnee b) {
+    if (!T_estDansLeTerrain(t, a) || !T_estDansLeTerrain(t, b)) {
+        return false;
+    }
+    if (t->composantes == NULL) {
+        return true;
+    }
+    return T_representant(t->composantes, CO_CoordonneeVersNumeroCase(a, t->taille)) ==
+        T_representant(t->composantes, CO_CoordonneeVersNumeroCase(b, t->taille));
 }
 
 /**
@@ -50,7 +282,17 @@ bool T_cheminExiste(T_Terrain t, CO_Coordonnee a, CO_Coordonnee b) {
  * @return true si c'est un objectif, false sinon
  */
 bool T_estUnObjectif(T_Terrain t, CO_Coordonnee c) {
-    return THE_estPresent(t.positionsObjectifs, &c);
+    return T_estUnObjectifRef(&t, c);
+}
+
+/**
+ * @brief Vérifie si une coordonnée est un objectif, sans copier le terrain
+ * @param t Pointeur vers le terrain
+ * @param c La coordonnée à vérifier
+ * @return true si c'est un objectif, false sinon
+ */
+bool T_estUnObjectifRef(const T_Terrain* t, CO_Coordonnee c) {
+    return THE_estPresentRef(&t->positionsObjectifs, &c);
 }
 
 /**
@@ -105,11 +347,407 @@ void T_ajouterObjectif(T_Terrain* t, CO_Coordonnee c) {
  * @param coordB Deuxième coordonnée
  */
 void T_ajouterChemin(T_Terrain* terrain, CO_Coordonnee coordA, CO_Coordonnee coordB) {
+    if (terrain->estFige) {
+        errno = T_TERRAIN_FIGE_ERREUR;
+        return;
+    }
+    if (!T_estDansLeTerrain(terrain, coordA) || !T_estDansLeTerrain(terrain, coordB)) {
+        errno = T_CHEMIN_HORS_TERRAIN_ERREUR;
+        return;
+    }
+    if (terrain->estGrille) {
+        T_ouvrirPassage(terrain, coordA, coordB);
+        return;
+    }
     unsigned int caseA = CO_CoordonneeVersNumeroCase(coordA, terrain->taille);
     unsigned int caseB = CO_CoordonneeVersNumeroCase(coordB, terrain->taille);
     
     // Ajouter l'arc (le graphe est non-orienté, donc un seul arc suffit)
-    G_ajouterArc(&terrain->chemins, caseA, caseB, NULL);
+    if (G_ajouterArc(&terrain->chemins, caseA, caseB, NULL) == 0) {
+        T_unirCases(terrain, coordA, coordB);
+    }
+}
+
+/**
+ * @brief Ajoute un chemin de coût donné entre deux coordonnées adjacentes
+ * @param terrain Pointeur vers le terrain
+ * @param coordA Première coordonnée
+ * @param coordB Deuxième coordonnée
+ * @param cout Coût de passage
+ */
+void T_ajouterCheminPondere(T_Terrain* terrain, CO_Coordonnee coordA, CO_Coordonnee coordB, float cout) {
+    if (terrain->estFige) {
+        errno = T_TERRAIN_FIGE_ERREUR;
+        return;
+    }
+    if (!(cout > 0.0f)) {
+        errno = T_COUT_ERREUR;
+        return;
+    }
+    if (!T_estDansLeTerrain(terrain, coordA) || !T_estDansLeTerrain(terrain, coordB)) {
+        errno = T_CHEMIN_HORS_TERRAIN_ERREUR;
+        return;
+    }
+    if (terrain->estGrille) {
+        errno = T_TERRAIN_GRILLE_ERREUR;
+        return;
+    }
+    // Le graphe ne devient pondéré qu'au premier chemin qui a un coût
+    if (G_activerPoids(&terrain->chemins) != 0) {
+        return;
+    }
+    unsigned int caseA = CO_CoordonneeVersNumeroCase(coordA, terrain->taille);
+    unsigned int caseB = CO_CoordonneeVersNumeroCase(coordB, terrain->taille);
+    if (G_ajouterArcPondere(&terrain->chemins, caseA, caseB, cout) == 0) {
+        T_unirCases(terrain, coordA, coordB);
+    } else {
+        // Chemin déjà présent : on garde le coût le plus faible
+        if (errno != G_ARC_DEJA_PRESENT_ERREUR || cout >= G_obtenirPoids(&terrain->chemins, caseA, caseB)) {
+            return;
+        }
+        G_fixerPoids(&terrain->chemins, caseA, caseB, cout);
+    }
+    if (cout < terrain->coutMinimal) {
+        terrain->coutMinimal = cout;
+    }
+}
+
+/**
+ * @brief Ajoute un lot de chemins en une seule fois
+ * @param terrain Pointeur vers le terrain
+ * @param coordsA Premières extrémités
+ * @param coordsB Secondes extrémités
+ * @param nb Nombre de chemins
+ * @return Le nombre de chemins ignorés
+ */
+unsigned int T_ajouterChemins(T_Terrain* terrain, const CO_Coordonnee coordsA[], const CO_Coordonnee coordsB[], unsigned int nb) {
+    if (terrain->estFige) {
+        errno = T_TERRAIN_FIGE_ERREUR;
+        return nb;
+    }
+    if (terrain->estGrille) {
+        int erreur = 0;
+        unsigned int nbIgnores = 0;
+        for (unsigned int i = 0; i < nb; i++) {
+            T_ajouterChemin(terrain, coordsA[i], coordsB[i]);
+            if (errno != 0) {
+                erreur = errno;
+                nbIgnores++;
+            }
+        }
+        errno = erreur;
+        return nbIgnores;
+    }
+    G_Arc* arcs = malloc((nb > 0 ? nb : 1) * sizeof(G_Arc));
+    if (arcs == NULL) {
+        errno = G_MEMOIRE_ERREUR;
+        return nb;
+    }
+    // Une extrémité hors du terrain donnerait le numéro d'une autre case : le chemin est écarté seul
+    unsigned int nbArcs = 0;
+    for (unsigned int i = 0; i < nb; i++) {
+        if (!T_estDansLeTerrain(terrain, coordsA[i]) || !T_estDansLeTerrain(terrain, coordsB[i])) {
+            continue;
+        }
+        arcs[nbArcs].src = CO_CoordonneeVersNumeroCase(coordsA[i], terrain->taille);
+        arcs[nbArcs].dest = CO_CoordonneeVersNumeroCase(coordsB[i], terrain->taille);
+        nbArcs++;
+    }
+    if (G_ajouterArcs(&terrain->chemins, arcs, nbArcs) < 0) {
+        free(arcs);
+        return nb;
+    }
+    free(arcs);
+    for (unsigned int i = 0; i < nb; i++) {
+        if (T_estDansLeTerrain(terrain, coordsA[i]) && T_estDansLeTerrain(terrain, coordsB[i])) {
+            T_unirCases(terrain, coordsA[i], coordsB[i]);
+        }
+    }
+    errno = (nbArcs < nb) ? T_CHEMIN_HORS_TERRAIN_ERREUR : 0;
+    return nb - nbArcs;
+}
+
+/**
+ * @brief Fige les chemins du terrain en un graphe CSR et libère le graphe modifiable
+ * @param t Pointeur vers le terrain
+ */
+void T_figer(T_Terrain* t) {
+    if (t->estFige) {
+        return;
+    }
+    if (t->estGrille) {
+        t->estFige = true;
+        T_aplatirComposantes(t);
+        errno = 0;
+        return;
+    }
+    G_GrapheFige gf = G_figer(t->chemins);
+    if (errno == G_MEMOIRE_ERREUR) {
+        return;
+    }
+    t->cheminsFiges = gf;
+    t->estFige = true;
+    T_aplatirComposantes(t);
+    G_vider(&t->chemins);
+    errno = 0;
+}
+
+/**
+ * @brief Crée un curseur sur les cases accessibles depuis une case
+ * @param t Pointeur vers le terrain
+ * @param numCase Numéro de la case
+ * @return Le curseur
+ */
+T_IterateurVoisins T_iterateurVoisins(const T_Terrain* t, unsigned int numCase) {
+    T_IterateurVoisins it;
+    it.nbVoisinsGrille = 0;
+    it.indiceGrille = 0;
+    it.voisinsGraphe.courant = NULL;
+    it.voisinsGraphe.fin = NULL;
+    it.voisinsGraphe.poids = NULL;
+    if (!t->estGrille) {
+        it.voisinsGraphe = t->estFige ? G_iterateurVoisinsFige(&t->cheminsFiges, numCase)
+                                      : G_iterateurVoisins(&t->chemins, numCase);
+        return it;
+    }
+    if (numCase == 0 || numCase > t->taille * t->taille) {
+        return it;
+    }
+    // Cases numérotées à partir de 1 : la case k est la (k-1)-ème de la grille
+    size_t indice = numCase - 1;
+    unsigned int x = (unsigned int)(indice % t->taille);
+    unsigned int y = (unsigned int)(indice / t->taille);
+    if (x + 1 < t->taille && T_estOuvert(t->ouvertures, 2 * indice + T_VERS_LA_DROITE)) {
+        it.voisinsGrille[it.nbVoisinsGrille++] = numCase + 1;
+    }
+    if (y + 1 < t->taille && T_estOuvert(t->ouvertures, 2 * indice + T_VERS_LE_BAS)) {
+        it.voisinsGrille[it.nbVoisinsGrille++] = numCase + t->taille;
+    }
+    if (x > 0 && T_estOuvert(t->ouvertures, 2 * (indice - 1) + T_VERS_LA_DROITE)) {
+        it.voisinsGrille[it.nbVoisinsGrille++] = numCase - 1;
+    }
+    if (y > 0 && T_estOuvert(t->ouvertures, 2 * (indice - t->taille) + T_VERS_LE_BAS)) {
+        it.voisinsGrille[it.nbVoisinsGrille++] = numCase - t->taille;
+    }
+    return it;
+}
+
+/**
+ * @brief Donne la case accessible suivante et le coût pour y passer
+ * @param pit Pointeur vers le curseur
+ * @param pnumCase Reçoit le numéro de la case
+ * @param pcout Reçoit le coût de passage
+ * @return false quand toutes les cases ont été données
+ */
+bool T_voisinSuivant(T_IterateurVoisins* pit, unsigned int* pnumCase, float* pcout) {
+    if (pit->indiceGrille < pit->nbVoisinsGrille) {
+        *pnumCase = pit->voisinsGrille[pit->indiceGrille++];
+        *pcout = 1.0f;
+        return true;
+    }
+    return G_voisinSuivantPondere(&pit->voisinsGraphe, pnumCase, pcout);
+}
+
+#define T_SIGNATURE 0x52524554U // "TERR" lu comme un entier petit-boutiste
+#define T_VERSION 2U
+#define T_MARQUEUR_OCTETS 0x01020304U
+#define T_OPTION_GRILLE 1U
+#define T_OPTION_COMPOSANTES 2U
+#define T_NB_ENTIERS_ENTETE 10
+
+/**
+ * @brief Nombre d'octets des ouvertures d'une grille de taille h
+ */
+static size_t T_tailleOuvertures(unsigned int h) {
+    return (2 * (size_t)h * h + 7) / 8;
+}
+
+/**
+ * @brief Écrit l'en-tête, les objectifs et les passages du terrain
+ * @param t Le terrain
+ * @param flux Flux ouvert en écriture binaire
+ * @return true en cas de succès
+ */
+static bool T_ecrire(T_Terrain t, FILE* flux) {
+    uint32_t entete[T_NB_ENTIERS_ENTETE];
+    unsigned int nbObjectifs = THE_cardinalite(t.positionsObjectifs);
+    entete[0] = T_SIGNATURE;
+    entete[1] = T_VERSION;
+    entete[2] = T_MARQUEUR_OCTETS;
+    entete[3] = (t.estGrille ? T_OPTION_GRILLE : 0U) | (t.composantes != NULL ? T_OPTION_COMPOSANTES : 0U);
+    entete[4] = t.taille;
+    entete[5] = CO_abscisse(t.positionDepart);
+    entete[6] = CO_ordonnee(t.positionDepart);
+    entete[7] = (uint32_t)t.directionDepart;
+    memcpy(&entete[8], &t.coutMinimal, sizeof(float));
+    entete[9] = nbObjectifs;
+    bool ok = fwrite(entete, sizeof(uint32_t), T_NB_ENTIERS_ENTETE, flux) == T_NB_ENTIERS_ENTETE;
+    THE_Iterateur itObjectifs = THE_iterateur(&t.positionsObjectifs);
+    const void* pobjectif;
+    while (ok && THE_suivant(&itObjectifs, &pobjectif)) {
+        const CO_Coordonnee* pc = (const CO_Coordonnee*)pobjectif;
+        uint32_t xy[2] = {CO_abscisse(*pc), CO_ordonnee(*pc)};
+        ok = fwrite(xy, sizeof(uint32_t), 2, flux) == 2;
+    }
+    if (!ok) {
+        return false;
+    }
+    if (t.estGrille) {
+        size_t taille = T_tailleOuvertures(t.taille);
+        // Complété par des zéros pour que la suite reste alignée sur 4 octets
+        static const unsigned char zeros[3] = {0, 0, 0};
+        ok = fwrite(t.ouvertures, 1, taille, flux) == taille &&
+            fwrite(zeros, 1, (4 - taille % 4) % 4, flux) == (4 - taille % 4) % 4;
+    } else if (t.estFige) {
+        ok = G_ecrireFige(&t.cheminsFiges, flux) == 0;
+    } else {
+        G_GrapheFige gf = G_figer(t.chemins);
+        if (errno == G_MEMOIRE_ERREUR) {
+            return false;
+        }
+        ok = G_ecrireFige(&gf, flux) == 0;
+        G_libererFige(&gf);
+    }
+    // Composantes, aplaties : le terrain chargé pourra les lire en place
+    size_t nbCases = (size_t)t.taille * t.taille + 1;
+    for (size_t i = 0; i < nbCases && ok && t.composantes != NULL; i++) {
+        uint32_t representant = T_representant(t.composantes, (unsigned int)i);
+        ok = fwrite(&representant, sizeof(uint32_t), 1, flux) == 1;
+    }
+    return ok;
+}
+
+/**
+ * @brief Sauvegarde le terrain dans un fichier binaire
+ * @param t Le terrain
+ * @param nomFichier Chemin du fichier
+ * @return 0 en cas de succès, -1 sinon
+ */
+int T_sauvegarder(T_Terrain t, const char* nomFichier) {
+    FILE* flux = fopen(nomFichier, "wb");
+    if (flux == NULL) {
+        errno = T_FICHIER_ERREUR;
+        return -1;
+    }
+    bool ok = T_ecrire(t, flux);
+    int erreur = (errno == G_MEMOIRE_ERREUR) ? G_MEMOIRE_ERREUR : T_FICHIER_ERREUR;
+    if (fclose(flux) != 0) {
+        ok = false;
+    }
+    errno = ok ? 0 : erreur;
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief Remplit le terrain (vide) t à partir d'un fichier projeté en mémoire
+ * @param t Pointeur vers le terrain
+ * @param zone Début du fichier
+ * @param taille Taille du fichier
+ * @return true si le contenu est valide
+ */
+static bool T_lire(T_Terrain* t, const void* zone, size_t taille) {
+    const uint32_t* entete = (const uint32_t*)zone;
+    if (taille < T_NB_ENTIERS_ENTETE * sizeof(uint32_t) || entete[0] != T_SIGNATURE || entete[1] != T_VERSION ||
+        entete[2] != T_MARQUEUR_OCTETS || (entete[3] & ~(T_OPTION_GRILLE | T_OPTION_COMPOSANTES)) != 0) {
+        return false;
+    }
+    size_t position = T_NB_ENTIERS_ENTETE * sizeof(uint32_t);
+    unsigned int nbObjectifs = entete[9];
+    if ((taille - position) / (2 * sizeof(uint32_t)) < nbObjectifs) {
+        return false;
+    }
+    if (entete[7] > (uint32_t)O) {
+        return false;
+    }
+    t->taille = entete[4];
+    t->positionDepart = CO_coordonnee(entete[5], entete[6]);
+    t->directionDepart = (DI_Direction)entete[7];
+    memcpy(&t->coutMinimal, &entete[8], sizeof(float));
+    const uint32_t* objectifs = entete + T_NB_ENTIERS_ENTETE;
+    for (unsigned int i = 0; i < nbObjectifs; i++) {
+        T_ajouterObjectif(t, CO_coordonnee(objectifs[2 * i], objectifs[2 * i + 1]));
+    }
+    position += (size_t)nbObjectifs * 2 * sizeof(uint32_t);
+    if (entete[3] & T_OPTION_GRILLE) {
+        if (taille - position < T_tailleOuvertures(t->taille)) {
+            return false;
+        }
+        t->estGrille = true;
+        t->ouvertures = (unsigned char*)zone + position;
+        position += (T_tailleOuvertures(t->taille) + 3) / 4 * 4;
+    } else {
+        size_t tailleLue;
+        if (G_lireFige((const unsigned char*)zone + position, taille - position, &t->cheminsFiges, &tailleLue) != 0) {
+            return false;
+        }
+        // Les ids sont des numéros de case (à partir de 1) : un id 0 ou au-delà de la grille
+        // donnerait à A* une coordonnée invalide ou hors du terrain
+        if (t->cheminsFiges.nbIds > (size_t)t->taille * t->taille + 1) {
+            return false;
+        }
+        for (unsigned int k = 0; k < t->cheminsFiges.nbEntrees; k++) {
+            if (t->cheminsFiges.voisins[k] == 0) {
+                return false;
+            }
+        }
+        position += tailleLue;
+    }
+    t->estFige = true;
+    if (entete[3] & T_OPTION_COMPOSANTES) {
+        size_t nbCases = (size_t)t->taille * t->taille + 1;
+        if (position > taille || (taille - position) / sizeof(uint32_t) < nbCases) {
+            return false;
+        }
+        const unsigned int* composantes = (const unsigned int*)((unsigned char*)zone + position);
+        // Les composantes sont écrites aplaties : chaque case doit désigner une case qui est son propre
+        // représentant, sans quoi T_representant lirait hors du tableau ou bouclerait sur un cycle
+        for (size_t i = 0; i < nbCases; i++) {
+            if (composantes[i] >= nbCases || composantes[composantes[i]] != composantes[i]) {
+                return false;
+            }
+        }
+        t->composantes = (unsigned int*)composantes;
+    }
+    return true;
+}
+
+/**
+ * @brief Charge un terrain sauvegardé par T_sauvegarder, sans recopier ses passages
+ * @param nomFichier Chemin du fichier
+ * @return Le terrain figé
+ */
+T_Terrain T_charger(const char* nomFichier) {
+    // Le graphe des chemins reste vide (non dense : aucune allocation par case)
+    T_Terrain t = T_terrain(0);
+    int fd = open(nomFichier, O_RDONLY);
+    struct stat infos;
+    if (fd < 0 || fstat(fd, &infos) != 0 || infos.st_size == 0) {
+        if (fd >= 0) close(fd);
+        errno = T_FICHIER_ERREUR;
+        return t;
+    }
+    size_t taille = (size_t)infos.st_size;
+    void* zone = mmap(NULL, taille, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // la projection reste valide après la fermeture
+    if (zone == MAP_FAILED) {
+        errno = T_FICHIER_ERREUR;
+        return t;
+    }
+    // Les composantes seront lues dans la projection
+    free(t.composantes);
+    free(t.rangsComposantes);
+    t.composantes = NULL;
+    t.rangsComposantes = NULL;
+    t.zone = zone;
+    t.tailleZone = taille;
+    if (!T_lire(&t, zone, taille)) {
+        T_supprimerTerrain(&t);
+        t = T_terrain(0);
+        errno = T_FICHIER_ERREUR;
+        return t;
+    }
+    errno = 0;
+    return t;
 }
 
 /**
@@ -119,6 +757,23 @@ void T_ajouterChemin(T_Terrain* terrain, CO_Coordonnee coordA, CO_Coordonnee coo
 void T_supprimerTerrain(T_Terrain* t) {
     // Vider le graphe des chemins
     G_vider(&t->chemins);
+    if (t->zone != NULL) {
+        // Les passages sont dans la projection du fichier
+        munmap(t->zone, t->tailleZone);
+        t->zone = NULL;
+        t->tailleZone = 0;
+    } else {
+        if (t->estFige && !t->estGrille) {
+            G_libererFige(&t->cheminsFiges);
+        }
+        free(t->ouvertures);
+        free(t->composantes);
+    }
+    free(t->rangsComposantes);
+    t->composantes = NULL;
+    t->rangsComposantes = NULL;
+    t->estFige = false;
+    t->ouvertures = NULL;
     
     // Vider l'ensemble des objectifs
     THE_vider(&t->positionsObjectifs);
@@ -0,0 +1,127 @@
+// trajet.h déclare des verrous POSIX
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <pthread.h>
+#include "trajet.h"
+#include "chemin.h"
+#include "analyseur_terrain.h"
+#include "terrain.h"
+#include "coordonnee.h"
+#include "TableHachageDictionnaire.h"
+#include "copieLiberationComparaisonTypesSimples.h"
+
+/*
+ * Vérifie les garanties de concurrence documentées dans tableHachage.h et trajet.h :
+ *   - plusieurs threads cherchent des chemins sur le même terrain figé (TR_plusCourtChemin,
+ *     et TR_plusCourtCheminAvecEspace avec un espace propre à chaque thread) ;
+ *   - ils partagent un cache des distances (TR_distance) ;
+ *   - ils consultent en même temps une même table qui n'est plus modifiée.
+ * Chaque résultat est comparé à celui calculé au préalable par un seul thread.
+ * A compiler aussi avec -fsanitize=thread pour détecter les accès concurrents non protégés.
+ */
+
+#define NB_THREADS 8
+#define NB_TOURS 20
+
+typedef struct {
+    const T_Terrain* pterrain;
+    TR_CacheDistances* pcache;
+    const THD_Dictionnaire* pdistances; // numéro (à partir de 1) de la case d'arrivée -> longueur de référence
+    CO_Coordonnee depart;
+    unsigned int nbCases;
+    bool avecEspace;
+    unsigned int nbErreurs;
+} Tache;
+
+static void* executerTache(void* ptache) {
+    Tache* t = (Tache*)ptache;
+    TR_EspaceTravail espace = TR_espaceTravail(t->avecEspace ? t->nbCases : 0);
+
+    for (unsigned int tour = 0; tour < NB_TOURS; tour++) {
+        for (int numCase = 1; numCase <= (int)t->nbCases; numCase++) {
+            const int* plongueur = (const int*)THD_valeurEmprunteeRef(t->pdistances, &numCase);
+            if (plongueur == NULL) {
+                t->nbErreurs++;
+                continue;
+            }
+            CO_Coordonnee arrivee = CO_NumeroCaseVersCoordonnee((unsigned int)numCase, T_obtenirTaille(*t->pterrain));
+            CH_Chemin chemin = t->avecEspace
+                ? TR_plusCourtCheminAvecEspace(*t->pterrain, t->depart, arrivee, &espace)
+                : TR_plusCourtChemin(*t->pterrain, t->depart, arrivee);
+            if ((int)CH_longueurChemin(chemin) != *plongueur) {
+                t->nbErreurs++;
+            }
+            CH_supprimerChemin(&chemin);
+            float distance = TR_distance(*t->pterrain, t->depart, arrivee, t->pcache);
+            // Terrain non pondéré : le chemin compte la case de départ, la distance ne compte que les pas
+            if (*plongueur == 0 ? !isinf(distance) : distance != (float)(*plongueur - 1)) {
+                t->nbErreurs++;
+            }
+        }
+    }
+    TR_supprimerEspaceTravail(&espace);
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <fichier_terrain.txt>\n", argv[0]);
+        return 1;
+    }
+    FILE* fichier = fopen(argv[1], "r");
+    if (fichier == NULL) {
+        perror("Erreur lors de l'ouverture du fichier");
+        return 1;
+    }
+    T_Terrain terrain = AT_analyseurTerrain(fichier);
+    fclose(fichier);
+    if (T_obtenirTaille(terrain) == 0) {
+        fprintf(stderr, "Erreur: Terrain invalide ou vide (Taille = 0).\n");
+        return 1;
+    }
+    // Les threads ne font que lire le terrain
+    T_figer(&terrain);
+
+    CO_Coordonnee depart = T_obtenirPositionDepart(terrain);
+    unsigned int nbCases = T_obtenirTaille(terrain) * T_obtenirTaille(terrain);
+
+    // Références calculées par un seul thread, rangées dans une table que les threads ne font que consulter
+    THD_Dictionnaire distances = THD_dictionnaireEnLigne(CLCTS_copierInt, CLCTS_libererInt, sizeof(int),
+                                                         CLCTS_copierInt, CLCTS_libererInt, sizeof(int),
+                                                         TH_hacherEntier);
+    THD_reserver(&distances, nbCases);
+    for (int numCase = 1; numCase <= (int)nbCases; numCase++) {
+        CH_Chemin chemin = TR_plusCourtChemin(terrain, depart,
+                                              CO_NumeroCaseVersCoordonnee((unsigned int)numCase, T_obtenirTaille(terrain)));
+        int longueur = (int)CH_longueurChemin(chemin);
+        THD_inserer(&distances, &numCase, &longueur);
+        CH_supprimerChemin(&chemin);
+    }
+
+    TR_CacheDistances cache = TR_cacheDistances(0);
+    pthread_t threads[NB_THREADS];
+    Tache taches[NB_THREADS];
+    for (unsigned int i = 0; i < NB_THREADS; i++) {
+        taches[i] = (Tache){&terrain, &cache, &distances, depart, nbCases, i % 2 == 0, 0};
+        if (pthread_create(&threads[i], NULL, executerTache, &taches[i]) != 0) {
+            perror("pthread_create");
+            return 1;
+        }
+    }
+    unsigned int nbErreurs = 0;
+    for (unsigned int i = 0; i < NB_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        nbErreurs += taches[i].nbErreurs;
+    }
+
+    printf("%d threads x %d tours x %u cases : %u erreur(s)\n", NB_THREADS, NB_TOURS, nbCases, nbErreurs);
+    TR_supprimerCacheDistances(&cache);
+    THD_vider(&distances);
+    T_supprimerTerrain(&terrain);
+    return nbErreurs == 0 ? 0 : 1;
+}
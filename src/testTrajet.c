@@ -1,3 +1,7 @@
+// trajet.h déclare des verrous POSIX
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include "trajet.h"
@@ -33,6 +37,9 @@ int main (int argc, char ** argv){
         return 1;
     }
     
+    // Le terrain ne sera plus modifié : on fige ses chemins pour accélérer les recherches
+    T_figer(&t);
+
     // 3. Définition des points
     CO_Coordonnee depart = T_obtenirPositionDepart(t);
     
@@ -69,6 +76,7 @@ int main (int argc, char ** argv){
             printf("Etape %u : (X = %u, Y = %u)\n", i, x, y); 
         }
     }
+    CH_supprimerChemin(&cheminObtenu);
     
     // Penser à libérer le terrain si une fonction existe (ex: T_libererTerrain(&t))
     return 0;
@@ -5,6 +5,10 @@
  * \version 1.1 (Ajout Algo Voyageur de Commerce)
  */
 
+/* le cache des distances (TableHachageConcurrente.h) a besoin des verrous POSIX */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include "trajet.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -14,6 +18,8 @@
 #include "terrain.h"  
 #include "ListeChaineeFile.h"
 #include "graphe.h"
+#include "TableHachageConcurrente.h"
+#include "allocateurBlocs.h"
 
 #include <limits.h> /* Pour INT_MAX */
 
@@ -46,7 +52,7 @@ static float distanceManhattan(CO_Coordonnee a, CO_Coordonnee b) {
 /**
  * \brief Trouve la coordonnée avec le plus petit f dans aVisiter
  */
-static CO_Coordonnee extraireMinF(LCL_Liste* aVisiter, THD_Dictionnaire coutF) {
+static CO_Coordonnee extraireMinF(LCL_Liste* aVisiter, const THD_Dictionnaire* pcoutF) {
     if (LCL_estVide(*aVisiter)) {
         return CO_coordonnee(UINT_MAX, UINT_MAX);
     }
@@ -57,56 +63,74 @@ static CO_Coordonnee extraireMinF(LCL_Liste* aVisiter, THD_Dictionnaire coutF) {
     
     // Trouver l'indice avec le plus petit f
     for (unsigned int i = 0; i < longueur; i++) {
-        CO_Coordonnee* coord = (CO_Coordonnee*)LCL_element(*aVisiter, i);
-        if (coord != NULL) {
-            float* pf = (float*)THD_valeur(coutF, coord);
-            if (pf != NULL && *pf < fMin) {
-                fMin = *pf;
-                indiceMin = i;
-            }
-            free(pf);
+        // Lecture sans copie : la coordonnée dans la liste, f dans le dictionnaire
+        const CO_Coordonnee* coord = (const CO_Coordonnee*)LCL_elementEmprunte(aVisiter, i);
+        const float* pf = (const float*)THD_valeurEmprunteeRef(pcoutF, (void*)coord);
+        if (pf != NULL && *pf < fMin) {
+            fMin = *pf;
+            indiceMin = i;
         }
-        free(coord);
     }
     
     // Extraire cette coordonnée
-    CO_Coordonnee* coordMin = (CO_Coordonnee*)LCL_element(*aVisiter, indiceMin);
-    CO_Coordonnee result = *coordMin;
-    free(coordMin);
+    CO_Coordonnee result = *(const CO_Coordonnee*)LCL_elementEmprunte(aVisiter, indiceMin);
     LCL_supprimer(aVisiter, indiceMin);
     
     return result;
 }
 
+/**
+ * \brief Clé du cache des distances : les deux extrémités, la plus petite case d'abord
+ * (les chemins du terrain sont à double sens, la distance est symétrique)
+ */
+static TR_PaireCoordonnees TR_paire(const T_Terrain* pterrain, CO_Coordonnee a, CO_Coordonnee b) {
+    TR_PaireCoordonnees paire;
+    unsigned int taille = T_obtenirTaille(*pterrain);
+    if (CO_CoordonneeVersNumeroCase(a, taille) <= CO_CoordonneeVersNumeroCase(b, taille)) {
+        paire.depart = a;
+        paire.arrivee = b;
+    } else {
+        paire.depart = b;
+        paire.arrivee = a;
+    }
+    return paire;
+}
+
+static void* TR_copierPaire(void* ppaire) {
+    TR_PaireCoordonnees* copie = (TR_PaireCoordonnees*)AB_allouer(sizeof(TR_PaireCoordonnees));
+    if (copie != NULL) {
+        *copie = *(TR_PaireCoordonnees*)ppaire;
+    }
+    return copie;
+}
+
+static void TR_libererPaire(void* ppaire) {
+    AB_liberer(ppaire, sizeof(TR_PaireCoordonnees));
+}
+
 /**
  * \brief Reconstruit le chemin depuis l'arrivée
  */
-static void TR_reconstruireChemin(CH_Chemin* leChemin, THD_Dictionnaire parents, CO_Coordonnee depart, CO_Coordonnee arrivee) {
+static void TR_reconstruireChemin(CH_Chemin* leChemin, const THD_Dictionnaire* pparents, CO_Coordonnee depart, CO_Coordonnee arrivee) {
     LCL_Liste pile = LCL_liste(CO_copier, CO_liberer);
     CO_Coordonnee courant = arrivee;
     
-    // Remonter du but au départ
+    // Remonter du but au départ (la pile grandit par la fin)
     while (!CO_sontEgales(courant, depart)) {
-        LCL_inserer(&pile, &courant, 0);
+        LCL_ajouterFin(&pile, &courant);
         
-        CO_Coordonnee* parent = (CO_Coordonnee*)THD_valeur(parents, &courant);
+        const CO_Coordonnee* parent = (const CO_Coordonnee*)THD_valeurEmprunteeRef(pparents, &courant);
         if (parent == NULL) break;
         
         courant = *parent;
-        free(parent);
     }
     
     // Ajouter le départ
-    LCL_inserer(&pile, &depart, 0);
+    LCL_ajouterFin(&pile, &depart);
     
-    // Dépiler dans le chemin
-    unsigned int longueur = LCL_longueur(pile);
-    for (unsigned int i = 0; i < longueur; i++) {
-        CO_Coordonnee* coord = (CO_Coordonnee*)LCL_element(pile, i);
-        if (coord != NULL) {
-            CH_enfilerEtape(leChemin, coord);
-            free(coord);
-        }
+    // Dépiler dans le chemin, du départ vers l'arrivée
+    for (unsigned int i = LCL_longueur(pile); i > 0; i--) {
+        CH_enfilerEtape(leChemin, (CO_Coordonnee*)LCL_elementEmprunte(&pile, i - 1));
     }
     
     LCL_vider(&pile);
@@ -115,125 +139,195 @@ static void TR_reconstruireChemin(CH_Chemin* leChemin, THD_Dictionnaire parents,
 
 /**
  * \brief Algorithme A* utilisant le graphe du terrain
+ * \param pterrain Le terrain (non modifié)
+ * \param depart Point de départ
+ * \param arrivee Point d'arrivée
+ * \param pespace Tables de travail, vides à l'entrée et rendues vides (capacité conservée)
+ * \param pchemin Chemin qui reçoit les étapes trouvées (NULL si seul le coût est voulu)
+ * \return Le coût du plus court chemin, INFINITY si l'arrivée n'est pas accessible
  */
-CH_Chemin TR_plusCourtChemin(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee) {
-    CH_Chemin leChemin = CH_chemin();
+static float TR_aEtoile(const T_Terrain* pterrain, CO_Coordonnee depart, CO_Coordonnee arrivee,
+                        TR_EspaceTravail* pespace, CH_Chemin* pchemin) {
+    float coutTotal = INFINITY;
+    
+    // Arrivée hors de la composante connexe du départ : inutile d'explorer toute la zone accessible
+    if (!T_sontConnecteesRef(pterrain, depart, arrivee)) {
+        return coutTotal;
+    }
     
     // Ensemble des coordonnées visitées (liste fermée)
-    THE_Ensemble noeudVisites = THE_ensemble(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee));
+    THE_Ensemble* pnoeudVisites = &(pespace->noeudVisites);
     
     // Liste des coordonnées à visiter (liste ouverte)
     LCL_Liste aVisiter = LCL_liste(CO_copier, CO_liberer);
     
-    // Dictionnaires pour stocker g, f et parents
-    // On utilise CO_Coordonnee comme clé pour tout
-    THD_Dictionnaire coutG = THD_dictionnaire(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee),
-                                              CLCTS_copierFloat, CLCTS_libererFloat);
-    THD_Dictionnaire coutF = THD_dictionnaire(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee),
-                                              CLCTS_copierFloat, CLCTS_libererFloat);
-    THD_Dictionnaire parents = THD_dictionnaire(CO_copier, CO_liberer, CO_comparer, sizeof(CO_Coordonnee),
-                                                CO_copier, CO_liberer);
+    // Dictionnaires pour stocker g, f et parents, fournis par l'espace de travail
+    THD_Dictionnaire* pcoutG = &(pespace->coutG);
+    THD_Dictionnaire* pcoutF = &(pespace->coutF);
+    THD_Dictionnaire* pparents = &(pespace->parents);
     
     // Initialiser le départ
     float gDepart = 0.0f;
-    float heuristique = distanceManhattan(depart, arrivee);
+    // Chaque pas coûte au moins coutMinimal : l'heuristique reste minorante (et cohérente) sur un terrain pondéré
+    float coutMinimal = pterrain->coutMinimal;
+    unsigned int taille = T_obtenirTaille(*pterrain);
+    float heuristique = distanceManhattan(depart, arrivee) * coutMinimal;
     float fDepart = gDepart + heuristique;
     
-    THD_inserer(&coutG, &depart, &gDepart);
-    THD_inserer(&coutF, &depart, &fDepart);
-    LCL_inserer(&aVisiter, &depart, 0);
+    THD_inserer(pcoutG, &depart, &gDepart);
+    THD_inserer(pcoutF, &depart, &fDepart);
+    LCL_ajouterFin(&aVisiter, &depart);
     
     // Boucle principale A*
     while (!LCL_estVide(aVisiter)) {
         // Extraire la coordonnée avec le plus petit f
-        CO_Coordonnee coordCourante = extraireMinF(&aVisiter, coutF);
+        CO_Coordonnee coordCourante = extraireMinF(&aVisiter, pcoutF);
         
         // Vérifier si c'est une coordonnée invalide
         if (CO_abscisse(coordCourante) == UINT_MAX) break;
         
         // Si on a atteint l'arrivée
         if (CO_sontEgales(coordCourante, arrivee)) {
-            THE_ajouter(&noeudVisites, &coordCourante);
-            TR_reconstruireChemin(&leChemin, parents, depart, arrivee);
+            THE_ajouter(pnoeudVisites, &coordCourante);
+            coutTotal = *(const float*)THD_valeurEmprunteeRef(pcoutG, &coordCourante);
+            if (pchemin != NULL) {
+                TR_reconstruireChemin(pchemin, pparents, depart, arrivee);
+            }
             break;
         }
         
         // Ajouter à la liste fermée (noeudVisites)
-        THE_ajouter(&noeudVisites, &coordCourante);
+        THE_ajouter(pnoeudVisites, &coordCourante);
         
         // Obtenir le coût g actuel
-        float* pCoutCourant = (float*)THD_valeur(coutG, &coordCourante);
+        const float* pCoutCourant = (const float*)THD_valeurEmprunteeRef(pcoutG, &coordCourante);
         float coutCourant = (pCoutCourant != NULL) ? *pCoutCourant : 0.0f;
-        if (pCoutCourant != NULL) free(pCoutCourant);
         
         // Convertir la coordonnée en numéro de case pour le graphe
-        unsigned int numCaseCourante = CO_CoordonneeVersNumeroCase(coordCourante, T_obtenirTaille(terrain));
-        
-        // Obtenir les voisins depuis le GRAPHE (G_obtenirSommetsAdjacents)
-        // Cette fonction retourne les numéros de cases adjacentes connectées par un arc
-        LCL_Liste voisins = G_obtenirSommetsAdjacents(terrain.chemins, numCaseCourante);
-        int nb_voisins = LCL_longueur(voisins);
+        unsigned int numCaseCourante = CO_CoordonneeVersNumeroCase(coordCourante, taille);
         
-        // Parcourir chaque voisin
-        for (int voisin = 0; voisin < nb_voisins; voisin++) {
-            // Récupérer le numéro de case du voisin
-            unsigned int* pNumVoisin = (unsigned int*)LCL_element(voisins, voisin);
-            if (pNumVoisin == NULL) continue;
-            
+        // Parcourir chaque voisin, directement dans le stockage du terrain (ni allocation, ni copie)
+        T_IterateurVoisins itVoisins = T_iterateurVoisins(pterrain, numCaseCourante);
+        unsigned int numVoisin;
+        float coutPassage;
+        while (T_voisinSuivant(&itVoisins, &numVoisin, &coutPassage)) {
             // Convertir le numéro de case en coordonnée
-            CO_Coordonnee coordVoisin = CO_NumeroCaseVersCoordonnee(*pNumVoisin, T_obtenirTaille(terrain));
-            free(pNumVoisin);
+            CO_Coordonnee coordVoisin = CO_NumeroCaseVersCoordonnee(numVoisin, taille);
             
             // Vérifier si déjà visité (dans noeudVisites)
-            if (THE_estPresent(noeudVisites, &coordVoisin)) {
+            if (THE_estPresentRef(pnoeudVisites, &coordVoisin)) {
                 continue;
             }
             
             // Calculer le nouveau coût g pour ce voisin
-            // Le graphe est non-orienté et non-valué, donc coût = 1 par arc
-            float coutVoisin = coutCourant + 1.0f;
+            // Le coût de passage est lu avec le voisin (1 si le terrain n'est pas pondéré)
+            float coutVoisin = coutCourant + coutPassage;
             
             // Vérifier si ce voisin est déjà dans aVisiter avec un meilleur coût
-            float* pGVoisinActuel = (float*)THD_valeur(coutG, &coordVoisin);
-            bool dejaPresent = (pGVoisinActuel != NULL);
+            float* pGVoisinActuel = (float*)THD_referenceValeur(pcoutG, &coordVoisin);
+            
+            // Calculer h(voisin) et f(voisin)
+            heuristique = distanceManhattan(coordVoisin, arrivee) * coutMinimal;
+            float f = coutVoisin + heuristique;
             
-            if (dejaPresent) {
+            if (pGVoisinActuel != NULL) {
                 // Si le nouveau chemin est moins bon, on ignore
                 if (coutVoisin >= *pGVoisinActuel) {
-                    free(pGVoisinActuel);
                     continue;
                 }
-                free(pGVoisinActuel);
-            }
-            
-            // Calculer h(voisin) et f(voisin)
-            heuristique = distanceManhattan(coordVoisin, arrivee);
-            float f = coutVoisin + heuristique;
-            
-            // Mettre à jour les dictionnaires
-            THD_inserer(&coutG, &coordVoisin, &coutVoisin);
-            THD_inserer(&coutF, &coordVoisin, &f);
-            THD_inserer(&parents, &coordVoisin, &coordCourante);
-            
-            // Ajouter à la liste ouverte (aVisiter) si pas déjà présent
-            if (!dejaPresent) {
-                LCL_inserer(&aVisiter, &coordVoisin, LCL_longueur(aVisiter));
+                // Sinon les trois valeurs sont mises à jour sur place, sans copie ni libération
+                *pGVoisinActuel = coutVoisin;
+                *(float*)THD_referenceValeur(pcoutF, &coordVoisin) = f;
+                *(CO_Coordonnee*)THD_referenceValeur(pparents, &coordVoisin) = coordCourante;
+            } else {
+                // Nouveau voisin : il entre dans les dictionnaires et dans la liste ouverte
+                THD_inserer(pcoutG, &coordVoisin, &coutVoisin);
+                THD_inserer(pcoutF, &coordVoisin, &f);
+                THD_inserer(pparents, &coordVoisin, &coordCourante);
+                LCL_ajouterFin(&aVisiter, &coordVoisin);
             }
         }
         
-        LCL_vider(&voisins);
     }
     
-    // Libérations des pointeurs allouées 
-    THE_vider(&noeudVisites);
+    // Les tables sont vidées mais gardent leurs cases pour la recherche suivante
     LCL_vider(&aVisiter);
-    THD_vider(&coutG);
-    THD_vider(&coutF);
-    THD_vider(&parents);
+    THE_reinitialiser(pnoeudVisites);
+    THD_reinitialiser(pcoutG);
+    THD_reinitialiser(pcoutF);
+    THD_reinitialiser(pparents);
     
+    return coutTotal;
+}
+
+TR_EspaceTravail TR_espaceTravail(unsigned int nbCasesPrevues) {
+    TR_EspaceTravail espace;
+    // On utilise CO_Coordonnee comme clé pour tout ; clés et valeurs sont rangées par valeur (aucune allocation par case)
+    espace.noeudVisites = THE_ensembleEnLigne(CO_copier, CO_liberer, sizeof(CO_Coordonnee), CO_hacher);
+    espace.coutG = THD_dictionnaireEnLigne(CO_copier, CO_liberer, sizeof(CO_Coordonnee),
+                                           CLCTS_copierFloat, CLCTS_libererFloat, sizeof(float), CO_hacher);
+    espace.coutF = THD_dictionnaireEnLigne(CO_copier, CO_liberer, sizeof(CO_Coordonnee),
+                                           CLCTS_copierFloat, CLCTS_libererFloat, sizeof(float), CO_hacher);
+    espace.parents = THD_dictionnaireEnLigne(CO_copier, CO_liberer, sizeof(CO_Coordonnee),
+                                             CO_copier, CO_liberer, sizeof(CO_Coordonnee), CO_hacher);
+    if (nbCasesPrevues > 0U) {
+        THE_reserver(&espace.noeudVisites, nbCasesPrevues);
+        THD_reserver(&espace.coutG, nbCasesPrevues);
+        THD_reserver(&espace.coutF, nbCasesPrevues);
+        THD_reserver(&espace.parents, nbCasesPrevues);
+    }
+    return espace;
+}
+
+void TR_supprimerEspaceTravail(TR_EspaceTravail* pespace) {
+    THE_vider(&(pespace->noeudVisites));
+    THD_vider(&(pespace->coutG));
+    THD_vider(&(pespace->coutF));
+    THD_vider(&(pespace->parents));
+}
+
+CH_Chemin TR_plusCourtCheminAvecEspace(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee,
+                                       TR_EspaceTravail* pespace) {
+    CH_Chemin leChemin = CH_chemin();
+    TR_aEtoile(&terrain, depart, arrivee, pespace, &leChemin);
     return leChemin;
 }
 
+CH_Chemin TR_plusCourtChemin(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee) {
+    TR_EspaceTravail espace = TR_espaceTravail(0U);
+    CH_Chemin leChemin = TR_plusCourtCheminAvecEspace(terrain, depart, arrivee, &espace);
+    TR_supprimerEspaceTravail(&espace);
+    return leChemin;
+}
+
+TR_CacheDistances TR_cacheDistances(unsigned int nbSegments) {
+    THD_Dictionnaire modele = THD_dictionnaireEnLigne(TR_copierPaire, TR_libererPaire, sizeof(TR_PaireCoordonnees),
+                                                      CLCTS_copierFloat, CLCTS_libererFloat, sizeof(float), NULL);
+    return THC_dictionnaire(modele, nbSegments);
+}
+
+float TR_distance(T_Terrain terrain, CO_Coordonnee depart, CO_Coordonnee arrivee, TR_CacheDistances* pcache) {
+    float distance;
+    TR_EspaceTravail espace;
+    TR_PaireCoordonnees paire = TR_paire(&terrain, depart, arrivee);
+    if (pcache != NULL && THC_lire(pcache, &paire, &distance)) {
+        return distance;
+    }
+    espace = TR_espaceTravail(0U);
+    distance = TR_aEtoile(&terrain, depart, arrivee, &espace, NULL);
+    TR_supprimerEspaceTravail(&espace);
+    if (pcache == NULL) {
+        return distance;
+    }
+    // Si un autre thread a rangé la même distance entre-temps, la sienne est conservée (elle est identique)
+    THC_insererSiAbsent(pcache, &paire, &distance);
+    return distance;
+}
+
+void TR_supprimerCacheDistances(TR_CacheDistances* pcache) {
+    THC_supprimerDictionnaire(pcache);
+}
+
 CH_Chemin TR_meilleurParcours(CO_Coordonnee depart, CO_Coordonnee objectifs[], int nbObjectifs) {
     CH_Chemin cheminComplet = CH_chemin(); 
     CO_Coordonnee positionActuelle = depart;
@@ -241,6 +335,8 @@ CH_Chemin TR_meilleurParcours(CO_Coordonnee depart, CO_Coordonnee objectifs[], i
 
     int estVisite[4] = {0}; 
     int nbVisites = 0;
+    // Les recherches successives réutilisent les mêmes tables
+    TR_EspaceTravail espace = TR_espaceTravail(0U);
 
     /* Algorithme du Plus Proche Voisin  */
     while (nbVisites < nbObjectifs) {
@@ -262,10 +358,11 @@ CH_Chemin TR_meilleurParcours(CO_Coordonnee depart, CO_Coordonnee objectifs[], i
         /* 2. Si on a trouvé un voisin */
         if (indexPlusProche != -1) {
             /* Calculer le vrai chemin (A*) vers cet objectif */
-            CH_Chemin segment = TR_plusCourtChemin(t, positionActuelle, objectifs[indexPlusProche]);
+            CH_Chemin segment = TR_plusCourtCheminAvecEspace(t, positionActuelle, objectifs[indexPlusProche], &espace);
             
             /* Ajouter ce segment au chemin final */
             TR_ajouterSegment(&cheminComplet, &segment);
+            CH_supprimerChemin(&segment);
 
             /* Mettre à jour l'état */
             estVisite[indexPlusProche] = 1;
@@ -277,6 +374,7 @@ CH_Chemin TR_meilleurParcours(CO_Coordonnee depart, CO_Coordonnee objectifs[], i
         }
     }
 
+    TR_supprimerEspaceTravail(&espace);
     return cheminComplet;
 }
 
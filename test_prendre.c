@@ -0,0 +1,259 @@
+/**
+ * \file test_prendre.c
+ * \brief Tests des variantes « Prendre » (transfert de propriété, sans copie) des listes, files et tables
+ */
+#include <CUnit/Basic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "listeChainee.h"
+#include "ListeChaineeFile.h"
+#include "ListeChaineeListe.h"
+#include "TableHachageDictionnaire.h"
+#include "copieLiberationComparaisonTypesSimples.h"
+
+/* Les éléments sont des int alloués par malloc : les copies et les libérations sont comptées
+   pour vérifier qui possède chaque bloc */
+static unsigned int nbCopies;
+static unsigned int nbLiberations;
+
+static void* copierEntier(void* p) {
+    int* copie = malloc(sizeof(int));
+    if (copie != NULL) {
+        *copie = *(int*)p;
+        nbCopies++;
+    }
+    return copie;
+}
+
+static void libererEntier(void* p) {
+    free(p);
+    nbLiberations++;
+}
+
+static int* entier(int valeur) {
+    int* p = malloc(sizeof(int));
+    *p = valeur;
+    return p;
+}
+
+int init_compteurs(void) {
+    nbCopies = 0;
+    nbLiberations = 0;
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                        TESTS : LISTE CHAINEE                               */
+/* -------------------------------------------------------------------------- */
+
+void test_lc_ajouter_prendre(void) {
+    LC_ListeChainee l = LC_listeChainee();
+    int* p1 = entier(1);
+    int* p2 = entier(2);
+
+    init_compteurs();
+    LC_ajouterPrendre(&l, p1);
+    LC_ajouterPrendre(&l, p2);
+    CU_ASSERT_EQUAL(errno, 0);
+    CU_ASSERT_TRUE(LC_obtenirElement(l) == p2);
+    CU_ASSERT_EQUAL(nbCopies, 0);
+
+    CU_ASSERT_TRUE(LC_supprimerTetePrendre(&l) == p2);
+    CU_ASSERT_TRUE(LC_supprimerTetePrendre(&l) == p1);
+    CU_ASSERT_TRUE(LC_estVide(l));
+    CU_ASSERT_EQUAL(nbLiberations, 0);
+    free(p1);
+    free(p2);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                        TESTS : FILE                                        */
+/* -------------------------------------------------------------------------- */
+
+void test_lcf_enfiler_defiler_prendre(void) {
+    LCF_ListeChaineeFile f = LCF_file(copierEntier, libererEntier);
+    int* elements[3];
+
+    init_compteurs();
+    for (int i = 0; i < 3; i++) {
+        elements[i] = entier(i);
+        LCF_enfilerPrendre(&f, elements[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        CU_ASSERT_TRUE(LCF_defilerPrendre(&f) == elements[i]);
+        free(elements[i]);
+    }
+    CU_ASSERT_TRUE(LCF_estVide(f));
+    CU_ASSERT_TRUE(LCF_defilerPrendre(&f) == NULL);
+    CU_ASSERT_EQUAL(errno, FILE_VIDE_ERREUR);
+    CU_ASSERT_EQUAL(nbCopies, 0);
+    CU_ASSERT_EQUAL(nbLiberations, 0);
+}
+
+void test_lcf_vider_libere_les_elements(void) {
+    LCF_ListeChaineeFile f = LCF_file(copierEntier, libererEntier);
+    int valeur = 7;
+
+    init_compteurs();
+    LCF_enfilerPrendre(&f, entier(1));
+    LCF_enfilerPrendre(&f, entier(2));
+    LCF_enfiler(&f, &valeur);
+    CU_ASSERT_EQUAL(nbCopies, 1);
+    LCF_vider(&f);
+    CU_ASSERT_TRUE(LCF_estVide(f));
+    CU_ASSERT_EQUAL(nbLiberations, 3);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                        TESTS : LISTE                                       */
+/* -------------------------------------------------------------------------- */
+
+void test_lcl_inserer_supprimer_prendre(void) {
+    LCL_Liste l = LCL_liste(copierEntier, libererEntier);
+    int* p1 = entier(1);
+    int* p2 = entier(2);
+    int* p3 = entier(3);
+
+    init_compteurs();
+    LCL_insererPrendre(&l, p2, 0);
+    LCL_insererPrendre(&l, p1, 0);
+    LCL_insererPrendre(&l, p3, 2);
+    CU_ASSERT_EQUAL(LCL_longueur(l), 3);
+    CU_ASSERT_TRUE(LCL_elementEmprunte(&l, 0) == p1);
+    CU_ASSERT_TRUE(LCL_elementEmprunte(&l, 2) == p3);
+
+    CU_ASSERT_TRUE(LCL_supprimerPrendre(&l, 1) == p2);
+    CU_ASSERT_EQUAL(LCL_longueur(l), 2);
+    CU_ASSERT_TRUE(LCL_elementEmprunte(&l, 1) == p3);
+    CU_ASSERT_EQUAL(nbCopies, 0);
+    CU_ASSERT_EQUAL(nbLiberations, 0);
+    free(p2);
+
+    LCL_vider(&l);
+    CU_ASSERT_EQUAL(nbLiberations, 2);
+}
+
+void test_lcl_erreur_laisse_l_element(void) {
+    LCL_Liste l = LCL_liste(copierEntier, libererEntier);
+    int* p = entier(1);
+
+    init_compteurs();
+    LCL_insererPrendre(&l, p, 1);
+    CU_ASSERT_EQUAL(errno, POSITION_HORS_BORNES_ERREUR);
+    CU_ASSERT_TRUE(LCL_supprimerPrendre(&l, 0) == NULL);
+    CU_ASSERT_EQUAL(errno, LISTE_VIDE_ERREUR);
+    CU_ASSERT_EQUAL(nbLiberations, 0);
+    free(p);
+    LCL_vider(&l);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                        TESTS : DICTIONNAIRE                                */
+/* -------------------------------------------------------------------------- */
+
+void test_thd_inserer_prendre(void) {
+    THD_Dictionnaire d = THD_dictionnaire(copierEntier, libererEntier, CLCTS_comparerInt, sizeof(int),
+                                          copierEntier, libererEntier, TH_hacherEntier);
+    int* cle = entier(4);
+    int* valeur = entier(40);
+    int cleCherchee = 4;
+
+    init_compteurs();
+    THD_insererPrendre(&d, cle, valeur);
+    CU_ASSERT_EQUAL(errno, 0);
+    CU_ASSERT_TRUE(THD_valeurEmprunteeRef(&d, &cleCherchee) == valeur);
+
+    /* la clé déjà présente est gardée : la clé reçue et l'ancienne valeur sont libérées */
+    int* nouvelle = entier(41);
+    THD_insererPrendre(&d, entier(4), nouvelle);
+    CU_ASSERT_EQUAL(THD_taille(d), 1);
+    CU_ASSERT_TRUE(THD_valeurEmprunteeRef(&d, &cleCherchee) == nouvelle);
+    CU_ASSERT_EQUAL(nbLiberations, 2);
+    CU_ASSERT_EQUAL(nbCopies, 0);
+
+    /* la valeur est rendue telle quelle, seule la clé rangée est libérée */
+    CU_ASSERT_TRUE(THD_supprimerPrendre(&d, &cleCherchee) == nouvelle);
+    CU_ASSERT_EQUAL(nbLiberations, 3);
+    CU_ASSERT_FALSE(THD_contientRef(&d, &cleCherchee));
+    free(nouvelle);
+
+    CU_ASSERT_TRUE(THD_supprimerPrendre(&d, &cleCherchee) == NULL);
+    CU_ASSERT_EQUAL(errno, TH_CLE_ABSENTE_ERREUR);
+    THD_vider(&d);
+}
+
+void test_thd_inserer_prendre_en_ligne(void) {
+    THD_Dictionnaire d = THD_dictionnaireEnLigne(copierEntier, libererEntier, sizeof(int),
+                                                 copierEntier, libererEntier, sizeof(int), TH_hacherEntier);
+    int cleCherchee = 5;
+
+    init_compteurs();
+    /* les octets sont rangés dans la case : les deux blocs reçus sont libérés aussitôt */
+    THD_insererPrendre(&d, entier(5), entier(50));
+    CU_ASSERT_EQUAL(nbLiberations, 2);
+    CU_ASSERT_EQUAL(*(const int*)THD_valeurEmprunteeRef(&d, &cleCherchee), 50);
+
+    /* la valeur n'existe que dans la case : elle est rendue copiée */
+    int* valeur = THD_supprimerPrendre(&d, &cleCherchee);
+    CU_ASSERT_TRUE(valeur != NULL && *valeur == 50);
+    CU_ASSERT_EQUAL(nbCopies, 1);
+    CU_ASSERT_EQUAL(THD_taille(d), 0);
+    free(valeur);
+    THD_vider(&d);
+}
+
+//============================================
+//===============MAIN ========================
+//============================================
+
+int main(int argc, char** argv) {
+    CU_pSuite pSuite_listes = NULL;
+    CU_pSuite pSuite_dictionnaires = NULL;
+
+    /* Initialisation du registre de tests */
+    if (CUE_SUCCESS != CU_initialize_registry())
+        return CU_get_error();
+
+    /* ===== Suite 1 : Listes et files ===== */
+    pSuite_listes = CU_add_suite("Tests : Listes et files sans copie", init_compteurs, init_compteurs);
+    if (NULL == pSuite_listes) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    if ((NULL == CU_add_test(pSuite_listes, "LC_ajouterPrendre / LC_supprimerTetePrendre", test_lc_ajouter_prendre))
+        || (NULL == CU_add_test(pSuite_listes, "LCF_enfilerPrendre / LCF_defilerPrendre", test_lcf_enfiler_defiler_prendre))
+        || (NULL == CU_add_test(pSuite_listes, "LCF_vider libère les éléments", test_lcf_vider_libere_les_elements))
+        || (NULL == CU_add_test(pSuite_listes, "LCL_insererPrendre / LCL_supprimerPrendre", test_lcl_inserer_supprimer_prendre))
+        || (NULL == CU_add_test(pSuite_listes, "Erreurs de LCL_*Prendre", test_lcl_erreur_laisse_l_element))
+    ) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    /* ===== Suite 2 : Dictionnaires ===== */
+    pSuite_dictionnaires = CU_add_suite("Tests : Dictionnaires sans copie", init_compteurs, init_compteurs);
+    if (NULL == pSuite_dictionnaires) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    if ((NULL == CU_add_test(pSuite_dictionnaires, "THD_insererPrendre / THD_supprimerPrendre", test_thd_inserer_prendre))
+        || (NULL == CU_add_test(pSuite_dictionnaires, "THD_*Prendre en ligne", test_thd_inserer_prendre_en_ligne))
+    ) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    /* Lancement des tests */
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    printf("\n");
+    CU_basic_show_failures(CU_get_failure_list());
+    printf("\n\n");
+
+    /* Nettoyage du registre */
+    CU_cleanup_registry();
+    return CU_get_error();
+}